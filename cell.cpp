@@ -11,7 +11,7 @@ const int SIZE = 5;
 
 // Constructor: Initialize a cell at given (x, y) with a type
 Cell::Cell(int posX, int posY, CELL_TYPE type)
-    : distance(0), visited(false) {
+    : layout(PATH), distance(0), startDistance(0), visited(false) {
     pos[0] = posX;                  // Set x position
     pos[1] = posY;                  // Set y position
     this->type = type;             // Set the cell type
@@ -25,6 +25,7 @@ void Cell::reset() {
         type = UNEXPLORED;         // Reset type unless it's START or TARGET
     }
     distance = 0;                  // Reset distance
+    startDistance = 0;             // Reset return distance
     visited = false;              // Mark as unvisited
     previous = nullptr;           // Clear path pointer
 
@@ -35,11 +35,13 @@ public:
     Cell(int posX = 0, int posY = 0, CELL_TYPE type = UNEXPLORED); // Create cell at (posX, posY) with a given type
     int pos[2];                                // (x, y) coordinates of the cell
     CELL_TYPE type;                            // Type of cell (START, TARGET, etc.)
+    CELL_TYPE layout;                          // Corridor shape from open sides (PATH, CORNER, JUNCTION3, JUNCTION4, DEAD_END)
 
     // Maze Navigation
     std::array<bool, 4> walls;                 // Wall status in 4 directions [UP, RIGHT, DOWN, LEFT]
     std::array<Cell*, 4> neighbors;            // Pointers to neighboring cells in each direction
     int distance;                              // Distance from the goal (used in flood fill or pathfinding)
+    int startDistance;                         // Distance from the start (used to plan the return trip)
     bool visited;                              // True if the cell has been visited
     bool inPerimeter;                          // True if this cell is part of the perimeter
     Cell* previous;                            // Pointer to the previous cell in a path
@@ -0,0 +1,129 @@
+// This file implements the Connectivity class declared in connectivity.h.
+// Opening a passage between two regions relabels the smaller one. Closing a passage runs two
+// searches, one from each side, one cell at a time in turn. If they meet, nothing changed. Otherwise
+// the side that runs out first is the part that was cut off, and only that side gets a new label.
+// Either way the work is bounded by the smaller side.
+
+#include "connectivity.h"
+#include <queue>
+
+// Label every region from scratch by flooding over open passages
+void Connectivity::reset(Cell* firstCell, int size) {
+    cells = firstCell;
+    this->size = size;
+    label.assign(size * size, -1);
+    mark.assign(size * size, 0);
+    regionSize.clear();
+    freeLabels.clear();
+    lastCut.clear();
+
+    for (int i = 0; i < size * size; ++i) {
+        if (label[i] != -1) continue;
+        relabel(&cells[i], -1, newLabel(), nullptr);
+    }
+}
+
+// Hand out a free label so the label count stays bounded by the number of cells
+int Connectivity::newLabel() {
+    if (!freeLabels.empty()) {
+        int reused = freeLabels.back();
+        freeLabels.pop_back();
+        return reused;
+    }
+    regionSize.push_back(0);
+    return static_cast<int>(regionSize.size()) - 1;
+}
+
+// Give every cell of the region around 'from' (currently labelled oldLabel) the label toLabel
+void Connectivity::relabel(Cell* from, int oldLabel, int toLabel, std::vector<Cell*>* collected) {
+    std::queue<Cell*> pending;
+    label[indexOf(from)] = toLabel;
+    pending.push(from);
+
+    while (!pending.empty()) {
+        Cell* current = pending.front(); pending.pop();
+        regionSize[toLabel]++;
+        if (oldLabel >= 0) regionSize[oldLabel]--;
+        if (collected) collected->push_back(current);
+
+        for (Direction dir : {UP, RIGHT, DOWN, LEFT}) {
+            if (!current->canMove(dir)) continue;
+            Cell* neighbor = current->neighbors[dir];
+            if (label[indexOf(neighbor)] == oldLabel) {
+                label[indexOf(neighbor)] = toLabel;
+                pending.push(neighbor);
+            }
+        }
+    }
+}
+
+// Check if a and b are in the same region
+bool Connectivity::isConnected(const Cell* a, const Cell* b) const {
+    return label[indexOf(a)] == label[indexOf(b)];
+}
+
+// Update the labels after the passage between a and b was opened or closed
+void Connectivity::passageChanged(Cell* a, Cell* b) {
+    int la = label[indexOf(a)];
+    int lb = label[indexOf(b)];
+    bool open = false;
+    for (Direction dir : {UP, RIGHT, DOWN, LEFT}) {
+        if (a->neighbors[dir] == b && a->canMove(dir)) open = true;
+    }
+
+    if (open) {
+        // Merge: the smaller region takes the larger one's label
+        if (la == lb) return;
+        if (regionSize[la] < regionSize[lb]) {
+            relabel(a, la, lb, nullptr);
+            freeLabels.push_back(la);  // Region la is now empty
+        } else {
+            relabel(b, lb, la, nullptr);
+            freeLabels.push_back(lb);
+        }
+        return;
+    }
+
+    if (la != lb) return;  // Already apart
+
+    // Closed: search from both sides in turn until they meet or one side runs out
+    int sideStamp[2] = { stamp + 1, stamp + 2 };
+    stamp += 2;
+    std::queue<Cell*> pending[2];
+    std::vector<Cell*> seen[2];
+    Cell* roots[2] = { a, b };
+
+    for (int side = 0; side < 2; ++side) {
+        mark[indexOf(roots[side])] = sideStamp[side];
+        pending[side].push(roots[side]);
+        seen[side].push_back(roots[side]);
+    }
+
+    while (!pending[0].empty() && !pending[1].empty()) {
+        for (int side = 0; side < 2; ++side) {
+            if (pending[side].empty()) break;
+            Cell* current = pending[side].front(); pending[side].pop();
+
+            for (Direction dir : {UP, RIGHT, DOWN, LEFT}) {
+                if (!current->canMove(dir)) continue;
+                Cell* neighbor = current->neighbors[dir];
+                int& neighborMark = mark[indexOf(neighbor)];
+
+                if (neighborMark == sideStamp[1 - side]) return;  // The searches met: still one region
+                if (neighborMark != sideStamp[side]) {
+                    neighborMark = sideStamp[side];
+                    pending[side].push(neighbor);
+                    seen[side].push_back(neighbor);
+                }
+            }
+        }
+    }
+
+    // One side ran out without meeting the other: it is the region that was cut off
+    int cut = pending[0].empty() ? 0 : 1;
+    int cutLabel = newLabel();
+    regionSize[cutLabel] = static_cast<int>(seen[cut].size());
+    regionSize[la] -= static_cast<int>(seen[cut].size());
+    for (Cell* cell : seen[cut]) label[indexOf(cell)] = cutLabel;
+    lastCut = seen[cut];
+}
@@ -0,0 +1,37 @@
+// This header file defines the Connectivity class, which keeps track of which cells of the maze are still connected.
+// Every cell carries a region label; two cells can reach each other exactly when their labels match.
+// Maze::setWall reports every changed passage, so a reachability question is a single label comparison.
+
+#ifndef CONNECTIVITY_H
+#define CONNECTIVITY_H
+
+#include "cell.h"
+#include <vector>
+
+class Connectivity {
+public:
+    void reset(Cell* firstCell, int size);               // Label the regions of a size x size row-major grid from scratch
+    void passageChanged(Cell* a, Cell* b);               // Update labels after the passage between two adjacent cells opened or closed
+    bool isConnected(const Cell* a, const Cell* b) const;  // True if a path exists between a and b
+    int getRegion(const Cell* cell) const { return label[indexOf(cell)]; }  // Region label of a cell
+    int getRegionSize(const Cell* cell) const { return regionSize[getRegion(cell)]; }  // Number of cells in its region
+    const std::vector<Cell*>& getLastCutRegion() const { return lastCut; }  // Cells split off by the most recent closing, empty if none
+    void clearLastCut() { lastCut.clear(); }             // Forget the last cut region (called at the start of every wall change)
+    int getLabelCount() const { return static_cast<int>(regionSize.size()); }  // Labels allocated so far (never more than the cell count)
+
+private:
+    int indexOf(const Cell* cell) const { return cell->pos[1] * size + cell->pos[0]; }
+    void relabel(Cell* from, int oldLabel, int toLabel, std::vector<Cell*>* collected);  // Flood a region with a new label
+    int newLabel();                 // Reuse a label whose region is empty, or allocate one
+
+    Cell* cells = nullptr;          // First cell of the grid
+    int size = 0;                   // Grid width and height
+    std::vector<int> label;         // Region label per cell
+    std::vector<int> regionSize;    // Cells per label
+    std::vector<int> freeLabels;    // Labels whose region became empty
+    std::vector<int> mark;          // Search stamps used while checking a split
+    int stamp = 0;                  // Current search stamp
+    std::vector<Cell*> lastCut;     // Cells of the region cut off last
+};
+
+#endif // CONNECTIVITY_H
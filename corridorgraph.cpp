@@ -0,0 +1,232 @@
+// This file implements the CorridorGraph class declared in corridorgraph.h.
+// The flood runs Dijkstra over the nodes only, using corridor lengths as edge weights,
+// then expands the result back to every cell of each corridor.
+
+#include "corridorgraph.h"
+#include <climits>
+#include <queue>
+#include <functional>
+#include <algorithm>
+
+// Count open sides and set the cell's layout
+void CorridorGraph::classify(int cell) {
+    Cell* c = cellAt(cell);
+    int open = 0;
+    for (Direction dir : {UP, RIGHT, DOWN, LEFT}) {
+        if (c->canMove(dir)) open++;
+    }
+    openSides[cell] = open;
+
+    if (open <= 1)      c->layout = DEAD_END;
+    else if (open == 3) c->layout = JUNCTION3;
+    else if (open == 4) c->layout = JUNCTION4;
+    else if (c->canMove(UP) == c->canMove(DOWN)) c->layout = PATH;  // Straight through
+    else                c->layout = CORNER;
+}
+
+// The start and target are always nodes so floods can begin there
+bool CorridorGraph::isNode(int cell) const {
+    if (openSides[cell] != 2) return true;
+    return cell == start || cell == target;
+}
+
+// A corridor ending in a dead end (other than the start or target) can never be on the way to anything else
+bool CorridorGraph::isDeadBranch(const Corridor& corridor) const {
+    for (int end : corridor.ends) {
+        if (openSides[end] <= 1 && end != start && end != target) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Follow two-sided cells from a node until the next node and store the corridor
+void CorridorGraph::trace(int node, Direction dir) {
+    Corridor corridor;
+    corridor.ends[0] = node;
+    corridor.endDirs[0] = dir;
+    corridor.alive = true;
+
+    Cell* current = cellAt(node)->neighbors[dir];
+    Direction arrived = dir;
+    while (!isNode(indexOf(current))) {
+        corridor.cells.push_back(indexOf(current));
+
+        // Leave through the open side we did not come in from
+        Direction back = current->oppositeDir(arrived);
+        for (Direction next : {UP, RIGHT, DOWN, LEFT}) {
+            if (next != back && current->canMove(next)) {
+                arrived = next;
+                break;
+            }
+        }
+        current = current->neighbors[arrived];
+    }
+    corridor.ends[1] = indexOf(current);
+    corridor.endDirs[1] = current->oppositeDir(arrived);
+
+    int id;
+    if (!freeIds.empty()) {
+        id = freeIds.back();
+        freeIds.pop_back();
+        corridors[id] = corridor;
+    } else {
+        id = static_cast<int>(corridors.size());
+        corridors.push_back(corridor);
+    }
+
+    nodeCorridor[corridor.ends[0]][corridor.endDirs[0]] = id;
+    nodeCorridor[corridor.ends[1]][corridor.endDirs[1]] = id;
+    for (int cell : corridor.cells) corridorOf[cell] = id;
+}
+
+// Drop a corridor and remember which (node, direction) pairs have to be traced again
+void CorridorGraph::removeCorridor(int id, std::vector<std::pair<int, Direction>>& reopen) {
+    Corridor& corridor = corridors[id];
+    if (!corridor.alive) return;
+
+    for (int end = 0; end < 2; ++end) {
+        nodeCorridor[corridor.ends[end]][corridor.endDirs[end]] = -1;
+        reopen.push_back({ corridor.ends[end], corridor.endDirs[end] });
+    }
+    for (int cell : corridor.cells) corridorOf[cell] = -1;
+
+    corridor.alive = false;
+    corridor.cells.clear();
+    freeIds.push_back(id);
+}
+
+// Classify every cell and trace every corridor from scratch
+void CorridorGraph::reset(Cell* firstCell, int size, Cell* start, Cell* target) {
+    cells = firstCell;
+    this->size = size;
+    this->start = indexOf(start);
+    this->target = indexOf(target);
+    corridors.clear();
+    freeIds.clear();
+    corridorOf.assign(size * size, -1);
+    openSides.assign(size * size, 0);
+    nodeCorridor.assign(size * size, std::vector<int>(4, -1));
+
+    for (int cell = 0; cell < size * size; ++cell) classify(cell);
+
+    for (int cell = 0; cell < size * size; ++cell) {
+        if (!isNode(cell)) continue;
+        for (Direction dir : {UP, RIGHT, DOWN, LEFT}) {
+            if (cellAt(cell)->canMove(dir) && nodeCorridor[cell][dir] == -1) trace(cell, dir);
+        }
+    }
+}
+
+// A passage only changes the open sides of its two cells
+void CorridorGraph::passageChanged(Cell* a, Cell* b) {
+    updateCells({ indexOf(a), indexOf(b) });
+}
+
+// The start and target are nodes, so moving them can split or join corridors around the old and new cells
+void CorridorGraph::setEndpoints(Cell* start, Cell* target) {
+    std::vector<int> changed = { this->start, this->target, indexOf(start), indexOf(target) };
+    this->start = indexOf(start);
+    this->target = indexOf(target);
+    updateCells(changed);
+}
+
+// Only the corridors running through or ending at the changed cells are removed and traced again
+void CorridorGraph::updateCells(const std::vector<int>& changed) {
+    std::vector<std::pair<int, Direction>> reopen;
+    for (int cell : changed) {
+        if (corridorOf[cell] != -1) removeCorridor(corridorOf[cell], reopen);
+        for (Direction side : {UP, RIGHT, DOWN, LEFT}) {
+            if (nodeCorridor[cell][side] != -1) removeCorridor(nodeCorridor[cell][side], reopen);
+        }
+    }
+
+    // Classify every touched cell before tracing, corridors may run through several of them
+    for (int cell : changed) {
+        classify(cell);
+        for (Direction side : {UP, RIGHT, DOWN, LEFT}) reopen.push_back({ cell, side });
+    }
+
+    for (const auto& end : reopen) {
+        int cell = end.first;
+        Direction side = end.second;
+        if (isNode(cell) && nodeCorridor[cell][side] == -1 &&
+            cellAt(cell)->canMove(side)) {
+            trace(cell, side);
+        }
+    }
+}
+
+// Dijkstra from source over the nodes, skipping dead branches, then expand to every cell
+void CorridorGraph::flood(Cell* source, int Cell::* field) {
+    std::vector<int> distance(size * size, INT_MAX);
+
+    typedef std::pair<int, int> Entry;  // (distance, node)
+    std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> open;
+    distance[indexOf(source)] = 0;
+    open.push({ 0, indexOf(source) });
+
+    while (!open.empty()) {
+        Entry top = open.top(); open.pop();
+        int node = top.second;
+        if (top.first > distance[node]) continue;  // Stale entry
+
+        for (int id : nodeCorridor[node]) {
+            if (id == -1) continue;
+            const Corridor& corridor = corridors[id];
+            if (isDeadBranch(corridor)) continue;
+
+            int other = corridor.ends[0] == node ? corridor.ends[1] : corridor.ends[0];
+            int length = static_cast<int>(corridor.cells.size()) + 1;
+            if (distance[other] > distance[node] + length) {
+                distance[other] = distance[node] + length;
+                open.push({ distance[other], other });
+            }
+        }
+    }
+
+    // Dead ends hang off a single corridor: reach them from its other end
+    for (const Corridor& corridor : corridors) {
+        if (!corridor.alive || !isDeadBranch(corridor)) continue;
+        int length = static_cast<int>(corridor.cells.size()) + 1;
+        for (int end = 0; end < 2; ++end) {
+            int from = distance[corridor.ends[1 - end]];
+            if (from != INT_MAX && distance[corridor.ends[end]] > from + length) {
+                distance[corridor.ends[end]] = from + length;
+            }
+        }
+    }
+
+    // Interior cells take the closer of the two ends
+    for (const Corridor& corridor : corridors) {
+        if (!corridor.alive) continue;
+        int length = static_cast<int>(corridor.cells.size()) + 1;
+        int fromStart = distance[corridor.ends[0]];
+        int fromEnd = distance[corridor.ends[1]];
+
+        for (int i = 0; i < static_cast<int>(corridor.cells.size()); ++i) {
+            int best = INT_MAX;
+            if (fromStart != INT_MAX) best = fromStart + i + 1;
+            if (fromEnd != INT_MAX) best = std::min(best, fromEnd + length - i - 1);
+            distance[corridor.cells[i]] = best;
+        }
+    }
+
+    for (int cell = 0; cell < size * size; ++cell) {
+        cellAt(cell)->*field = distance[cell];
+    }
+}
+
+// Number of cells that are graph nodes
+int CorridorGraph::getNodeCount() const {
+    int nodes = 0;
+    for (int cell = 0; cell < size * size; ++cell) {
+        if (isNode(cell)) nodes++;
+    }
+    return nodes;
+}
+
+// Number of live corridors
+int CorridorGraph::getCorridorCount() const {
+    return static_cast<int>(corridors.size() - freeIds.size());
+}
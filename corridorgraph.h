@@ -0,0 +1,52 @@
+// This header file defines the CorridorGraph class, a compressed view of the maze used by the flood fill.
+// Every cell gets a CELL_TYPE layout from its open sides. Cells with exactly two open sides (PATH and CORNER)
+// are folded into corridors: weighted edges between junctions, dead ends, the start and the target.
+// Dead-end branches are left out of the shortest-path search and filled in afterwards.
+// Maze owns the graph and keeps it current from setWall, setStart and setTarget.
+
+#ifndef CORRIDORGRAPH_H
+#define CORRIDORGRAPH_H
+
+#include "cell.h"
+#include <vector>
+#include <utility>
+
+class CorridorGraph {
+public:
+    void reset(Cell* firstCell, int size, Cell* start, Cell* target);  // Classify a size x size row-major grid and trace all corridors
+    void passageChanged(Cell* a, Cell* b);            // Re-trace only the corridors touching two cells whose passage opened or closed
+    void setEndpoints(Cell* start, Cell* target);     // Move the start/target, re-tracing the corridors around old and new cells
+    void flood(Cell* source, int Cell::* field);      // Distances from source (start or target) into the given Cell field
+    int getNodeCount() const;                         // Number of nodes (cells that are not folded into a corridor)
+    int getCorridorCount() const;                     // Number of live corridors
+
+private:
+    // A run of two-sided cells between two nodes
+    struct Corridor {
+        int ends[2];             // Node cell at each end (equal for a loop)
+        Direction endDirs[2];    // Direction leaving each end node into the corridor
+        std::vector<int> cells;  // Interior cells, ordered from ends[0] to ends[1]
+        bool alive;              // False once removed (slot can be reused)
+    };
+
+    int indexOf(const Cell* cell) const { return cell->pos[1] * size + cell->pos[0]; }
+    Cell* cellAt(int cell) const { return &cells[cell]; }
+    void classify(int cell);                          // Set the cell's layout from its open sides
+    bool isNode(int cell) const;                      // True unless the cell is a plain two-sided corridor cell
+    bool isDeadBranch(const Corridor& corridor) const;  // True if one end is an unprotected dead end
+    void trace(int node, Direction dir);              // Follow a corridor from a node and record it
+    void updateCells(const std::vector<int>& changed);  // Re-classify cells and re-trace the corridors touching them
+    void removeCorridor(int id, std::vector<std::pair<int, Direction>>& reopen);  // Drop a corridor, remember its ends
+
+    Cell* cells = nullptr;                            // First cell of the grid
+    int size = 0;                                     // Grid width and height
+    int start = -1;                                   // Start cell index (always a node)
+    int target = -1;                                  // Target cell index (always a node)
+    std::vector<Corridor> corridors;                  // All corridors (dead slots are reused)
+    std::vector<int> freeIds;                         // Removed corridor slots
+    std::vector<std::vector<int>> nodeCorridor;       // Per node and direction: corridor id, -1 if none
+    std::vector<int> corridorOf;                      // Per interior cell: corridor id, -1 for nodes and unlinked cells
+    std::vector<int> openSides;                       // Number of open sides per cell
+};
+
+#endif // CORRIDORGRAPH_H
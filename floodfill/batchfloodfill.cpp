@@ -0,0 +1,126 @@
+// This file implements the BatchFloodfill class.
+// The result for each lane matches Floodfill::updateFloodValues for both the goal and the start field:
+// a neighbor is reached when the current cell can move to it, and it gets the BFS level it was first reached at.
+
+#include "batchfloodfill.h"
+#include <climits>
+
+// Constructor: start with every lane empty
+BatchFloodfill::BatchFloodfill() {
+    for (int lane = 0; lane < BATCH_LANES; ++lane) {
+        clearLane(lane);
+    }
+}
+
+// Empty a lane: no goal, no passages
+void BatchFloodfill::clearLane(int lane) {
+    canUp[lane] = canRight[lane] = canDown[lane] = canLeft[lane] = 0;
+    goal[lane] = start[lane] = 0;
+    for (int cell = 0; cell < SIZE * SIZE; ++cell) {
+        distance[cell][lane] = INT_MAX;
+        startDistance[cell][lane] = INT_MAX;
+    }
+}
+
+// Pack a maze's open sides, goal and start into bit masks
+void BatchFloodfill::loadMaze(int lane, Maze& maze) {
+    clearLane(lane);
+
+    for (int y = 0; y < SIZE; ++y) {
+        for (int x = 0; x < SIZE; ++x) {
+            const Cell* cell = maze.getCell(x, y);
+            uint32_t bit = 1u << (y * SIZE + x);
+
+            // Same test as the scalar flood: a linked neighbor without a wall in between
+            if (cell->canMove(UP))    canUp[lane] |= bit;
+            if (cell->canMove(RIGHT)) canRight[lane] |= bit;
+            if (cell->canMove(DOWN))  canDown[lane] |= bit;
+            if (cell->canMove(LEFT))  canLeft[lane] |= bit;
+        }
+    }
+
+    const Cell* target = maze.getTarget();
+    goal[lane] = 1u << (target->pos[1] * SIZE + target->pos[0]);
+
+    const Cell* origin = maze.getStart();
+    start[lane] = 1u << (origin->pos[1] * SIZE + origin->pos[0]);
+}
+
+// Flood every lane from its goal, then from its start
+void BatchFloodfill::updateFloodValues() {
+    floodFrom(goal, distance);        // Outbound field
+    floodFrom(start, startDistance);  // Return field
+}
+
+// Level-synchronous BFS over all lanes: each level expands every lane's frontier by one step
+void BatchFloodfill::floodFrom(const uint32_t* seed, int (*field)[BATCH_LANES]) {
+    uint32_t reached[BATCH_LANES];
+    uint32_t frontier[BATCH_LANES];
+
+    for (int lane = 0; lane < BATCH_LANES; ++lane) {
+        reached[lane] = frontier[lane] = seed[lane];
+    }
+    for (int cell = 0; cell < SIZE * SIZE; ++cell) {
+        for (int lane = 0; lane < BATCH_LANES; ++lane) {
+            field[cell][lane] = ((seed[lane] >> cell) & 1) ? 0 : INT_MAX;  // Seed has zero distance
+        }
+    }
+
+    for (int level = 1; level < SIZE * SIZE; ++level) {
+        uint32_t active = 0;
+
+        for (int lane = 0; lane < BATCH_LANES; ++lane) {
+            uint32_t f = frontier[lane];
+            uint32_t next = ((f & canUp[lane]) >> SIZE) | ((f & canDown[lane]) << SIZE) |
+                            ((f & canLeft[lane]) >> 1) | ((f & canRight[lane]) << 1);
+            next &= ~reached[lane];
+            reached[lane] |= next;
+            frontier[lane] = next;
+            active |= next;
+        }
+
+        if (!active) break;  // Every lane has finished
+
+        for (int cell = 0; cell < SIZE * SIZE; ++cell) {
+            for (int lane = 0; lane < BATCH_LANES; ++lane) {
+                field[cell][lane] = ((frontier[lane] >> cell) & 1) ? level : field[cell][lane];
+            }
+        }
+    }
+}
+
+// Distance of (x, y) in one lane
+int BatchFloodfill::getDistance(int lane, int x, int y) const {
+    return distance[y * SIZE + x][lane];
+}
+
+// Start distance of (x, y) in one lane
+int BatchFloodfill::getStartDistance(int lane, int x, int y) const {
+    return startDistance[y * SIZE + x][lane];
+}
+
+// Copy a lane's distances into the maze cells and rebuild the path links the way Floodfill does
+void BatchFloodfill::storeDistances(int lane, Maze& maze) const {
+    for (int y = 0; y < SIZE; ++y) {
+        for (int x = 0; x < SIZE; ++x) {
+            maze.getCell(x, y)->distance = distance[y * SIZE + x][lane];
+            maze.getCell(x, y)->startDistance = startDistance[y * SIZE + x][lane];
+        }
+    }
+
+    // Links need every distance in place: point at the first open neighbor one step closer to the goal
+    for (int y = 0; y < SIZE; ++y) {
+        for (int x = 0; x < SIZE; ++x) {
+            Cell* cell = maze.getCell(x, y);
+            cell->previous = nullptr;
+            if (cell->distance == INT_MAX || cell->distance == 0) continue;
+
+            for (Direction dir : {UP, RIGHT, DOWN, LEFT}) {
+                if (cell->canMove(dir) && cell->neighbors[dir]->distance == cell->distance - 1) {
+                    cell->previous = cell->neighbors[dir];
+                    break;
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,40 @@
+//  This file defines the BatchFloodfill class, which floods many small mazes at once.
+//  A whole SIZE x SIZE board fits in one 32-bit mask per wall direction, so each maze is one lane
+//  and every BFS level is a handful of shifts and masks applied to all lanes together.
+//  The lane loops have a fixed trip count and no branches, so the compiler turns them into SIMD code.
+
+#ifndef BATCHFLOODFILL_H
+#define BATCHFLOODFILL_H
+
+#include "../maze.h"
+#include <cstdint>
+
+const int BATCH_LANES = 16;  // Mazes flooded together
+
+class BatchFloodfill {
+public:
+    BatchFloodfill();                                 // All lanes empty
+    void loadMaze(int lane, Maze& maze);              // Copy the walls, goal and start of a maze into a lane
+    void clearLane(int lane);                         // Make a lane empty again (it floods to nothing)
+    void updateFloodValues();                         // Flood every lane from its goal and its start, level by level in lockstep
+    int getDistance(int lane, int x, int y) const;    // Distance from the goal, INT_MAX if unreachable
+    int getStartDistance(int lane, int x, int y) const;  // Distance from the start, INT_MAX if unreachable
+    void storeDistances(int lane, Maze& maze) const;  // Write a lane's distance and startDistance fields into the maze cells and relink previous
+
+private:
+    static_assert(SIZE * SIZE <= 32, "a board must fit in one 32-bit lane");
+
+    void floodFrom(const uint32_t* seed, int (*field)[BATCH_LANES]);  // Lockstep BFS of all lanes from one seed bit each
+
+    // Bit (y * SIZE + x) is set if the flood may leave that cell in the given direction
+    uint32_t canUp[BATCH_LANES];
+    uint32_t canRight[BATCH_LANES];
+    uint32_t canDown[BATCH_LANES];
+    uint32_t canLeft[BATCH_LANES];
+    uint32_t goal[BATCH_LANES];                       // Goal cell bit of each lane
+    uint32_t start[BATCH_LANES];                      // Start cell bit of each lane
+    int distance[SIZE * SIZE][BATCH_LANES];           // Cell-major so each cell's lanes are contiguous
+    int startDistance[SIZE * SIZE][BATCH_LANES];      // Same layout, seeded from the start
+};
+
+#endif // BATCHFLOODFILL_H
@@ -14,8 +14,10 @@
 const Direction Floodfill::directions[4] = { UP, RIGHT, DOWN, LEFT };
 
 // Constructor: Initialize Floodfill with reference to the maze
-Floodfill::Floodfill(Maze& maze) : maze(maze) {
-    updateFloodValues(); // Start with flood values from goal
+Floodfill::Floodfill(Maze& maze, bool initialFlood) : maze(maze) {
+    if (initialFlood) {
+        updateFloodValues(); // Start with flood values from goal
+    }
 }
 
 // Reset all cells' distances and paths to initial state
@@ -23,6 +25,7 @@ void Floodfill::resetFloodValues() {
     for (int y = 0; y < SIZE; y++) {
         for (int x = 0; x < SIZE; x++) {
             maze.getCell(x, y)->distance = INT_MAX;  // Reset distance
+            maze.getCell(x, y)->startDistance = INT_MAX;  // Reset return distance
             maze.getCell(x, y)->previous = nullptr;  // Reset previous pointer
         }
     }
@@ -30,9 +33,103 @@ void Floodfill::resetFloodValues() {
 
 // Recalculate flood values from current robot position
 void Floodfill::reflood(Cell* robot) {
+    refloodActive = false; // A full flood supersedes any bounded one in progress
     updateFloodValues(); // Use standard flood update
 }
 
+// Limit how much work one bounded reflood step may do
+void Floodfill::setRefloodBudget(int maxRelaxations, std::chrono::microseconds maxTime) {
+    this->maxRelaxations = maxRelaxations > 0 ? maxRelaxations : 1; // Always make progress
+    maxRefloodTime = maxTime;
+}
+
+// Seed a bounded reflood: clear the pending field and start from the goal
+void Floodfill::startReflood() {
+    pendingDistance.fill(INT_MAX);
+    pendingStartDistance.fill(INT_MAX);
+    refloodQueue = std::queue<Cell*>();
+    startQueue = std::queue<Cell*>();
+
+    Cell* goal = maze.getTarget();
+    pendingDistance[goal->pos[1] * SIZE + goal->pos[0]] = 0;
+    refloodQueue.push(goal);
+
+    Cell* start = maze.getStart();
+    pendingStartDistance[start->pos[1] * SIZE + start->pos[0]] = 0;
+    startQueue.push(start);
+    refloodActive = true;
+}
+
+// Expand queued cells of one pending field until it is done or the step budget is spent
+bool Floodfill::expandPending(std::queue<Cell*>& queue, std::array<int, SIZE * SIZE>& pending, int& relaxations,
+                              std::chrono::steady_clock::time_point stepStart) {
+    while (!queue.empty()) {
+        if (relaxations >= maxRelaxations) return false;
+        if (maxRefloodTime.count() > 0 && relaxations > 0 &&
+            std::chrono::steady_clock::now() - stepStart >= maxRefloodTime) return false;
+
+        Cell* current = queue.front(); queue.pop();
+        int currentDistance = pending[current->pos[1] * SIZE + current->pos[0]];
+        ++relaxations;
+
+        for (Direction dir : directions) {
+            Cell* neighbor = current->neighbors[dir];
+            if (current->isWall(dir) || neighbor == nullptr) continue;
+
+            int& neighborDistance = pending[neighbor->pos[1] * SIZE + neighbor->pos[0]];
+            if (neighborDistance > currentDistance + 1) {
+                neighborDistance = currentDistance + 1;
+                queue.push(neighbor);
+            }
+        }
+    }
+
+    return true;
+}
+
+// Expand at most maxRelaxations cells (or until maxRefloodTime runs out), then stop.
+// The goal field is finished first so moves can use it early; the start field follows.
+// Once both frontiers are empty the new fields are copied into the cells.
+bool Floodfill::refloodStep() {
+    if (!refloodActive) return true;
+
+    auto stepStart = std::chrono::steady_clock::now();
+    int relaxations = 0;
+
+    if (!expandPending(refloodQueue, pendingDistance, relaxations, stepStart)) return false;
+    if (!expandPending(startQueue, pendingStartDistance, relaxations, stepStart)) return false;
+
+    // Both frontiers exhausted: publish the finished fields
+    for (int y = 0; y < SIZE; y++) {
+        for (int x = 0; x < SIZE; x++) {
+            maze.getCell(x, y)->distance = pendingDistance[y * SIZE + x];
+            maze.getCell(x, y)->startDistance = pendingStartDistance[y * SIZE + x];
+        }
+    }
+    linkPrevious();
+    refloodActive = false;
+    return true;
+}
+
+// Pick a move from the partially rebuilt field. BFS labels are final once assigned, so a labelled cell
+// with a neighbor labelled exactly one lower is on a shortest path in the new maze. Any other cell may
+// still be far from its real distance, so the robot waits there until the reflood catches up.
+Cell* Floodfill::getConservativeMove(Cell* current) {
+    int currentDistance = pendingDistance[current->pos[1] * SIZE + current->pos[0]];
+    if (currentDistance == INT_MAX) return current; // Not labelled yet
+
+    for (Direction dir : directions) {
+        if (current->canMove(dir)) {
+            Cell* neighbor = current->neighbors[dir];
+            if (pendingDistance[neighbor->pos[1] * SIZE + neighbor->pos[0]] == currentDistance - 1) {
+                return neighbor;
+            }
+        }
+    }
+
+    return current;
+}
+
 // Check if robot is trapped (no accessible neighbors)
 bool Floodfill::isTrapped(Cell* current) {
     for (Direction dir : directions) {
@@ -46,39 +143,27 @@ bool Floodfill::isTrapped(Cell* current) {
     return true; // All paths blocked or unreachable
 }
 
-// Update all cell distances starting from the goal (flood-fill)
+// Update all cell distances starting from the goal and from the start (flood-fill).
+// The flood runs on the maze's corridor graph and is expanded back to every cell.
 void Floodfill::updateFloodValues() {
     resetFloodValues(); // Reset all distances
-    Cell* goal = maze.getTarget();
-    goal->distance = 0; // Goal has zero distance
-
-    std::queue<Cell*> floodQueue;
-    floodQueue.push(goal); // Start from the goal
-
-    while (!floodQueue.empty()) {
-        Cell* current = floodQueue.front(); floodQueue.pop();
-
-        for (Direction dir : directions) {
-            int dx = 0, dy = 0;
-            switch (dir) {
-                case UP:    dy = -1; break;
-                case DOWN:  dy = 1;  break;
-                case LEFT:  dx = -1; break;
-                case RIGHT: dx = 1;  break;
-                default: continue;
-            }
+    maze.floodFrom(maze.getTarget(), &Cell::distance);      // Outbound field
+    maze.floodFrom(maze.getStart(), &Cell::startDistance);  // Return field
+    linkPrevious();
+}
 
-            int nx = current->pos[0] + dx;
-            int ny = current->pos[1] + dy;
-
-            if (nx >= 0 && nx < SIZE && ny >= 0 && ny < SIZE) {
-                if (!current->isWall(dir)) {
-                    Cell* neighbor = maze.getCell(nx, ny);
-                    if (neighbor->distance > current->distance + 1) {
-                        neighbor->distance = current->distance + 1;
-                        neighbor->previous = current;
-                        floodQueue.push(neighbor);
-                    }
+// Rebuild the path links: a reached cell points at any open neighbor one step closer to the goal
+void Floodfill::linkPrevious() {
+    for (int y = 0; y < SIZE; y++) {
+        for (int x = 0; x < SIZE; x++) {
+            Cell* cell = maze.getCell(x, y);
+            cell->previous = nullptr;
+            if (cell->distance == INT_MAX || cell->distance == 0) continue;
+
+            for (Direction dir : directions) {
+                if (cell->canMove(dir) && cell->neighbors[dir]->distance == cell->distance - 1) {
+                    cell->previous = cell->neighbors[dir];
+                    break;
                 }
             }
         }
@@ -103,30 +188,107 @@ Cell* Floodfill::getBestMove(Cell* current) {
     return nextCell;
 }
 
+// Compute one step towards the goal without moving the robot.
+// Returns the cell itself when the robot should wait for a bounded reflood to progress,
+// and nullptr if the robot is trapped or no valid move exists even after reflooding.
+Cell* Floodfill::nextMove(Cell* current) {
+    auto stepStart = std::chrono::steady_clock::now();
+    Cell* nextCell = nullptr;
+
+    if (!maze.isGoalReachable(current)) {
+        addToPath(current);
+        return nullptr; // Walls cut the goal off: no flood can help
+    }
+
+    if (!refloodActive) {
+        nextCell = getBestMove(current);
+
+        if (!nextCell && !isTrapped(current)) {
+            startReflood(); // Update distances based on current state, a budget at a time
+        }
+    }
+
+    if (refloodActive) {
+        nextCell = refloodStep() ? getBestMove(current) : getConservativeMove(current);
+    }
+
+    if (nextCell != current) {
+        addToPath(current);
+    }
+
+    auto stepTime = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - stepStart);
+    worstStepLatency = std::max(worstStepLatency, stepTime);
+    return nextCell;
+}
+
 // Generate a full path for the robot using flood values
 bool Floodfill::computePath(Robot& robot, Cell* current) {
     while (current != maze.getTarget()) {
-        path[pathIndex++] = current;
-        Cell* nextCell = getBestMove(current);
+        Cell* nextCell = nextMove(current);
+        if (!nextCell) return false;
+        if (nextCell == current) continue; // Reflood still running, wait in place
 
-        if (!nextCell) {
-            if (isTrapped(current)) {
-                return false; // No way out
+        robot.move(nextCell);        // Move robot
+        current = robot.getPosition();
+        std::this_thread::sleep_for(std::chrono::milliseconds(1500)); // Pause for visibility
+        handleUserInput(current);   // Optional wall updates
+        maze.display();
+    }
+
+    addToPath(current); // Add target to path
+    return true;
+}
+
+// Append a cell to the stored path
+void Floodfill::addToPath(Cell* cell) {
+    if (pathIndex < static_cast<int>(path.size())) {
+        path[pathIndex++] = cell;
+    }
+}
+
+// Determine the next cell on the way back to the start.
+// Any neighbor one step closer to the start is on a shortest known route; among those,
+// unexplored cells are preferred so the trip home also explores what it can for free.
+Cell* Floodfill::getBestReturnMove(Cell* current) {
+    Cell* nextCell = nullptr;
+    int minDistance = current->startDistance;
+
+    for (Direction dir : directions) {
+        if (!current->isWall(dir)) {
+            Cell* neighbor = current->neighbors[dir];
+            if (neighbor == nullptr) continue;
+
+            if (neighbor->startDistance < minDistance ||
+                (nextCell && neighbor->startDistance == minDistance &&
+                 neighbor->type == UNEXPLORED && nextCell->type != UNEXPLORED)) {
+                minDistance = neighbor->startDistance;
+                nextCell = neighbor;
             }
+        }
+    }
 
-            reflood(current); // Update distances based on current state
-            nextCell = getBestMove(current);
+    return nextCell;
+}
+
+// Walk the robot back to the start using the start distance field
+bool Floodfill::computeReturnPath(Robot& robot, Cell* current) {
+    if (!maze.isConnected(current, maze.getStart())) {
+        return false; // The start is cut off from here
+    }
+
+    while (current != maze.getStart()) {
+        Cell* nextCell = getBestReturnMove(current);
+
+        if (!nextCell) {
+            reflood(current); // Walls found on the way out may have changed the route home
+            nextCell = getBestReturnMove(current);
             if (!nextCell) return false;
         }
 
         robot.move(nextCell);        // Move robot
         current = robot.getPosition();
-        std::this_thread::sleep_for(std::chrono::milliseconds(1500)); // Pause for visibility
-        handleUserInput(current);   // Optional wall updates
-        maze.display();
     }
 
-    path[pathIndex++] = current; // Add target to path
     return true;
 }
 
@@ -188,6 +350,13 @@ void Floodfill::handleUserInput(Cell* current) {
             maze.setWall(x, y, wallDir, true); // Add wall to maze
             std::cout << "Wall added at (" << x << ", " << y << ") in direction " << dir << "\n";
 
+            // The last cut only covers the most recent wall, so report it before the next one
+            if (!maze.isGoalReachable(maze.getRobot())) {
+                std::cout << "The goal is no longer reachable from the robot.\n";
+            } else if (!maze.getLastCutRegion().empty()) {
+                std::cout << "A region of " << maze.getLastCutRegion().size() << " cells was cut off.\n";
+            }
+
             Cell* wallCell = maze.getCell(x, y);
             if (wallCell) {
                 wallCell->printNeighbors();
@@ -8,23 +8,34 @@
 #include "../maze.h"
 #include "queue.h"
 #include <climits>  
+#include <chrono>
+#include <queue>
 #include "../robot.h"
 
 class Robot; 
 
 class Floodfill {
 public:
-    Floodfill(Maze& maze);       // Constructor: Initializes the floodfill system with a maze reference
+    Floodfill(Maze& maze, bool initialFlood = true);  // Constructor: Initializes the floodfill system with a maze reference (skip the flood if distances were restored)
     void reflood(Cell* start);       // Recalculate flood values from a given start cell when walls are discovered
     Cell* getBestMove(Cell* current);  // Determine the best move based on current flood values
-    void updateFloodValues();          // Propagate updated flood values from the goal cell across the maze
+    void updateFloodValues();          // Propagate updated flood values from the goal and the start cell across the maze (on the corridor graph)
     void resetFloodValues();           // Set all cell flood values (distances) to infinity
     bool computePath(Robot& robot, Cell* current);    // Compute a valid path for the robot from current to goal
+    Cell* getBestReturnMove(Cell* current);           // Next cell on a shortest known route to the start, preferring unexplored cells
+    bool computeReturnPath(Robot& robot, Cell* current);  // Walk the robot back to the start along the start distance field
+    Cell* nextMove(Cell* current);                    // Single step of computePath: next cell, current to wait, nullptr if stuck
+    void setRefloodBudget(int maxRelaxations, std::chrono::microseconds maxTime);  // Limit reflood work per step (0 time = no time limit)
+    bool refloodStep();                               // Continue the bounded reflood, returns true once it has finished
+    bool isRefloodPending() const { return refloodActive; }  // True while a bounded reflood is still in progress
+    std::chrono::microseconds getWorstStepLatency() const { return worstStepLatency; }  // Slowest nextMove so far
+    void addToPath(Cell* cell);                       // Append a cell to the stored path (ignored once the path is full)
     bool isTrapped(Cell* current);                    // Check if the robot is trapped (no unblocked neighbors)
     const std::array<Cell*, 256>& getPath() const;    // Return the currently stored path
     void setPath(const std::array<Cell*, 256>& newPath);   // Overwrite the current path with a new one
     void displayPath() const;                              // Print the stored path for debugging
     int getPathIndex() const { return pathIndex; }         // Get the current index in the path array
+    Maze& getMaze() const { return maze; }                 // Get the maze this floodfill works on
     void handleUserInput(Cell* current);                   // Allow manual wall input during runtime (for testing)
 
 private:
@@ -33,6 +44,22 @@ private:
     std::array<Cell*, 256> path;  // Array holding the computed path cells
     int pathIndex = 0;            // Current index in the path
     static const Direction directions[4];   // Cardinal directions (UP, RIGHT, DOWN, LEFT)
+
+    void linkPrevious();                          // Point each reached cell's previous at a neighbor one step closer to the goal
+
+    // Bounded (anytime) reflood state
+    void startReflood();                          // Seed a new bounded reflood from the goal and the start
+    bool expandPending(std::queue<Cell*>& queue, std::array<int, SIZE * SIZE>& pending, int& relaxations,
+                       std::chrono::steady_clock::time_point stepStart);  // Run one field within the budget, true once done
+    Cell* getConservativeMove(Cell* current);     // Step to a neighbor labelled one lower in the partial field, current to wait
+    std::array<int, SIZE * SIZE> pendingDistance; // Distances being rebuilt (INT_MAX = not reached yet)
+    std::array<int, SIZE * SIZE> pendingStartDistance;  // Start distances being rebuilt
+    std::queue<Cell*> refloodQueue;               // BFS frontier of the bounded reflood
+    std::queue<Cell*> startQueue;                 // BFS frontier of the start field, expanded after the goal field
+    bool refloodActive = false;                   // True while pendingDistance is incomplete
+    int maxRelaxations = INT_MAX;                 // Cells expanded per refloodStep
+    std::chrono::microseconds maxRefloodTime{0};  // Time limit per refloodStep (0 = unlimited)
+    std::chrono::microseconds worstStepLatency{0};  // Worst nextMove duration seen
 };
 
 #endif  // FLOODFILL_H
@@ -21,4 +21,87 @@ QueueNode Queue::pop() {
 // Check if the queue is empty
 bool Queue::isEmpty() const {
     return queue.empty();
-}
\ No newline at end of file
+}
+
+// Constructor: reserve the two in-memory chunks
+SpillQueue::SpillQueue(size_t chunkNodes) : chunkNodes(chunkNodes ? chunkNodes : 1) {
+    head.reserve(this->chunkNodes);
+    tail.reserve(this->chunkNodes);
+}
+
+// Destructor: remove the temporary file
+SpillQueue::~SpillQueue() {
+    if (spill) std::fclose(spill);
+}
+
+// Push a new QueueNode to the back, spilling the back chunk to disk when it is full
+void SpillQueue::push(int x, int y, int distance) {
+    tail.push_back(QueueNode(x, y, distance));
+    ++count;
+
+    if (tail.size() < chunkNodes) return;
+
+    if (ioFailed) return;  // Spilling already failed once: keep everything in memory
+
+    if (!spill) spill = std::tmpfile();
+    if (spill && std::fseek(spill, writeOffset, SEEK_SET) == 0 &&
+        std::fwrite(tail.data(), sizeof(QueueNode), tail.size(), spill) == tail.size()) {
+        writeOffset += static_cast<long>(tail.size() * sizeof(QueueNode));
+        tail.clear();
+    } else {
+        ioFailed = true;  // The chunk stays in memory, no further writes are tried; reported through failed()
+    }
+}
+
+// Pop a QueueNode from the front, refilling the front chunk from disk (oldest first) or from the back chunk
+QueueNode SpillQueue::pop() {
+    if (isEmpty()) {
+        return QueueNode(-1, -1, -1);
+    }
+
+    if (headPos == head.size()) {
+        head.clear();
+        headPos = 0;
+
+        if (readOffset < writeOffset) {
+            size_t available = static_cast<size_t>(writeOffset - readOffset) / sizeof(QueueNode);
+            size_t n = available < chunkNodes ? available : chunkNodes;
+            head.resize(n);
+            if (std::fseek(spill, readOffset, SEEK_SET) != 0) n = 0;
+            n = n ? std::fread(head.data(), sizeof(QueueNode), n, spill) : 0;
+            head.resize(n);
+            readOffset += static_cast<long>(n * sizeof(QueueNode));
+
+            if (readOffset == writeOffset) {
+                readOffset = writeOffset = 0;  // File drained, reuse it from the start
+            }
+        }
+
+        if (head.empty()) {
+            head.swap(tail);
+        }
+        if (head.empty()) {
+            ioFailed = true;  // Reported through failed()
+            count = 0;  // The spilled items are lost
+            return QueueNode(-1, -1, -1);
+        }
+    }
+
+    --count;
+    return head[headPos++];
+}
+
+// Check if the queue is empty
+bool SpillQueue::isEmpty() const {
+    return count == 0;
+}
+
+// Drop all items, forget the spill file contents and clear the failure flag
+void SpillQueue::clear() {
+    head.clear();
+    tail.clear();
+    headPos = 0;
+    readOffset = writeOffset = 0;
+    count = 0;
+    ioFailed = false;
+}
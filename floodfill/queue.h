@@ -2,11 +2,15 @@
 #define QUEUE_H
 
 #include <queue>  
+#include <vector>
+#include <cstdio>
+#include <cstddef>
 
 
 // Define a struct to represent each queue node with coordinates (x, y) and manhattan distance.
 struct QueueNode {
     int x, y, distance;
+    QueueNode() : x(-1), y(-1), distance(-1) {}
     QueueNode(int _x, int _y, int _dist) : x(_x), y(_y), distance(_dist) {}
 };
 
@@ -28,5 +32,44 @@ public:
 private:
     std::queue<QueueNode> queue;  // Store QueueNode objects
 };
+
+// FIFO queue of QueueNode objects that keeps at most two chunks in memory.
+// Once the back chunk fills up it is appended to a temporary file, and chunks are read back in order when the front runs dry.
+class SpillQueue {
+public:
+    explicit SpillQueue(size_t chunkNodes = 1 << 16);
+    ~SpillQueue();
+    SpillQueue(const SpillQueue&) = delete;             // Owns the temporary file
+    SpillQueue& operator=(const SpillQueue&) = delete;
+
+    // Add an item to the back of queue
+    void push(int x, int y, int distance);
+
+    // Remove an item from the front the queue
+    QueueNode pop();
+
+    // Check if the queue is empty
+    bool isEmpty() const;
+
+    // Number of queued items (in memory and on disk)
+    size_t size() const { return count; }
+
+    // True once a spill write or read-back failed (items were lost or memory is no longer bounded)
+    bool failed() const { return ioFailed; }
+
+    // Drop all items and clear the failure flag
+    void clear();
+
+private:
+    std::vector<QueueNode> head;   // Front chunk being consumed
+    size_t headPos = 0;            // Next item to pop from head
+    std::vector<QueueNode> tail;   // Back chunk being filled
+    std::FILE* spill = nullptr;    // Temporary file holding the chunks between head and tail
+    long readOffset = 0;           // File offset of the oldest unread chunk
+    long writeOffset = 0;          // File offset where the next chunk is appended
+    size_t count = 0;              // Total number of queued items
+    size_t chunkNodes;             // Items per chunk
+    bool ioFailed = false;         // Set on the first failed spill write or read
+};
 #endif // QUEUE_H
 
@@ -0,0 +1,58 @@
+// This file implements the TiledFloodfill class.
+// It is the same breadth-first flood as Floodfill::updateFloodValues, but it works on (x, y)
+// coordinates through the TiledMaze interface instead of Cell pointers.
+
+#include "tiledfloodfill.h"
+#include <climits>
+#include <iostream>
+
+// Direction array used in traversal
+const Direction TiledFloodfill::directions[4] = { UP, RIGHT, DOWN, LEFT };
+
+// Constructor: Initialize with reference to the tiled maze
+TiledFloodfill::TiledFloodfill(TiledMaze& maze, size_t queueChunk)
+    : maze(maze), floodQueue(queueChunk) {}
+
+// Update all cell distances starting from the goal (flood-fill).
+// Returns false if the frontier could not be spilled or read back, the field is then incomplete.
+bool TiledFloodfill::updateFloodValues(int goalX, int goalY) {
+    floodQueue.clear();
+    maze.resetDistances(); // Reset all distances, tile by tile
+    maze.setDistance(goalX, goalY, 0); // Goal has zero distance
+    floodQueue.push(goalX, goalY, 0); // Start from the goal
+    cellsReached = 1;
+
+    while (!floodQueue.isEmpty()) {
+        QueueNode current = floodQueue.pop();
+
+        for (Direction dir : directions) {
+            int dx = 0, dy = 0;
+            switch (dir) {
+                case UP:    dy = -1; break;
+                case DOWN:  dy = 1;  break;
+                case LEFT:  dx = -1; break;
+                case RIGHT: dx = 1;  break;
+                default: continue;
+            }
+
+            int nx = current.x + dx;
+            int ny = current.y + dy;
+
+            if (nx >= 0 && nx < maze.getWidth() && ny >= 0 && ny < maze.getHeight()) {
+                if (!maze.isWall(current.x, current.y, dir)) {
+                    if (maze.getDistance(nx, ny) > current.distance + 1) {
+                        maze.setDistance(nx, ny, current.distance + 1);
+                        floodQueue.push(nx, ny, current.distance + 1);
+                        ++cellsReached;
+                    }
+                }
+            }
+        }
+    }
+
+    if (floodQueue.failed()) {
+        std::cout << "Error: tiled flood incomplete, the frontier queue failed\n";
+        return false;
+    }
+    return true;
+}
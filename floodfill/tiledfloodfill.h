@@ -0,0 +1,24 @@
+//  This file defines the TiledFloodfill class, the flood-fill pass for out-of-core TiledMaze grids.
+//  Distances are written straight into the maze tiles and the BFS frontier lives in a SpillQueue,
+//  so neither the distance field nor the frontier has to fit in memory.
+
+#ifndef TILEDFLOODFILL_H
+#define TILEDFLOODFILL_H
+
+#include "../tiledmaze.h"
+#include "queue.h"
+
+class TiledFloodfill {
+public:
+    TiledFloodfill(TiledMaze& maze, size_t queueChunk = 1 << 16);  // Bind to a maze, frontier chunk size in cells
+    bool updateFloodValues(int goalX, int goalY);   // Propagate distances from the goal cell, false if the frontier spill failed
+    long long getCellsReached() const { return cellsReached; }  // Number of cells reached by the last flood
+
+private:
+    TiledMaze& maze;          // Reference to the tiled maze
+    SpillQueue floodQueue;    // Frontier of the BFS, spills to disk when large
+    long long cellsReached = 0;
+    static const Direction directions[4];   // Cardinal directions (UP, RIGHT, DOWN, LEFT)
+};
+
+#endif // TILEDFLOODFILL_H
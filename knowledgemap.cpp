@@ -0,0 +1,152 @@
+// This file implements the KnowledgeMap class declared in knowledgemap.h.
+// Walls are updated with atomic fetch_or. Each distance buffer works like a seqlock: the writer
+// makes its sequence odd, rewrites the buffer, makes it even again and then advances the epoch.
+// Readers copy the published buffer and retry if its sequence changed during the copy.
+
+#include "knowledgemap.h"
+#include <climits>
+#include <queue>
+
+// Constructor: set perimeter walls and publish the first flood as epoch 0
+KnowledgeMap::KnowledgeMap(int goalX, int goalY)
+    : goal(goalY * SIZE + goalX), wallVersion(0), epoch(0) {
+    for (int y = 0; y < SIZE; ++y) {
+        for (int x = 0; x < SIZE; ++x) {
+            uint8_t bits = 0;
+            if (y == 0)        bits |= 1 << UP;
+            if (x == SIZE - 1) bits |= 1 << RIGHT;
+            if (y == SIZE - 1) bits |= 1 << DOWN;
+            if (x == 0)        bits |= 1 << LEFT;
+            walls[y * SIZE + x].store(bits, std::memory_order_relaxed);
+        }
+    }
+
+    sequence[0].store(0, std::memory_order_relaxed);
+    sequence[1].store(0, std::memory_order_relaxed);
+
+    std::array<int, MAP_CELLS> distance;
+    floodInto(distance);
+    for (int i = 0; i < MAP_CELLS; ++i) {
+        distances[0][i].store(distance[i], std::memory_order_relaxed);
+        distances[1][i].store(INT_MAX, std::memory_order_relaxed);
+    }
+}
+
+// Publish a wall on this cell and on the neighbor behind it
+bool KnowledgeMap::setWall(int x, int y, Direction dir) {
+    uint8_t bit = static_cast<uint8_t>(1 << dir);
+    uint8_t before = walls[y * SIZE + x].fetch_or(bit, std::memory_order_acq_rel);
+
+    int nx = x, ny = y;
+    switch (dir) {
+        case UP:    ny--; break;
+        case DOWN:  ny++; break;
+        case LEFT:  nx--; break;
+        case RIGHT: nx++; break;
+    }
+    if (nx >= 0 && nx < SIZE && ny >= 0 && ny < SIZE) {
+        Direction oppositeDir = static_cast<Direction>((dir + 2) % 4);  // Get opposite direction
+        walls[ny * SIZE + nx].fetch_or(static_cast<uint8_t>(1 << oppositeDir), std::memory_order_acq_rel);
+    }
+
+    if (before & bit) return false;  // Someone already knew about it
+    wallVersion.fetch_add(1, std::memory_order_acq_rel);
+    return true;
+}
+
+// Check if there's a known wall at (x, y) in the given direction
+bool KnowledgeMap::isWall(int x, int y, Direction dir) const {
+    return (walls[y * SIZE + x].load(std::memory_order_acquire) >> dir) & 1;
+}
+
+// Breadth-first flood from the goal over the currently known walls
+void KnowledgeMap::floodInto(std::array<int, MAP_CELLS>& distance) const {
+    distance.fill(INT_MAX);
+    distance[goal] = 0;
+
+    std::queue<int> floodQueue;
+    floodQueue.push(goal);
+
+    while (!floodQueue.empty()) {
+        int current = floodQueue.front(); floodQueue.pop();
+        int x = current % SIZE, y = current / SIZE;
+        uint8_t bits = walls[current].load(std::memory_order_acquire);
+
+        const int next[4] = { current - SIZE, current + 1, current + SIZE, current - 1 };  // UP, RIGHT, DOWN, LEFT
+        for (int dir = UP; dir <= LEFT; ++dir) {
+            if ((bits >> dir) & 1) continue;  // Wall (perimeter walls keep us inside the grid)
+            if ((dir == RIGHT && x == SIZE - 1) || (dir == LEFT && x == 0)) continue;
+            if ((dir == UP && y == 0) || (dir == DOWN && y == SIZE - 1)) continue;
+
+            int neighbor = next[dir];
+            if (distance[neighbor] > distance[current] + 1) {
+                distance[neighbor] = distance[current] + 1;
+                floodQueue.push(neighbor);
+            }
+        }
+    }
+}
+
+// Recompute distances into the spare buffer, then publish it as the next epoch
+void KnowledgeMap::reflood() {
+    std::lock_guard<std::mutex> lock(writerMutex);
+
+    std::array<int, MAP_CELLS> distance;
+    floodInto(distance);
+
+    unsigned long next = epoch.load(std::memory_order_relaxed) + 1;
+    int buffer = static_cast<int>(next % 2);
+
+    unsigned seq = sequence[buffer].load(std::memory_order_relaxed);
+    sequence[buffer].store(seq + 1, std::memory_order_relaxed);  // Odd: buffer is being rewritten
+    std::atomic_thread_fence(std::memory_order_release);
+
+    for (int i = 0; i < MAP_CELLS; ++i) {
+        distances[buffer][i].store(distance[i], std::memory_order_relaxed);
+    }
+
+    sequence[buffer].store(seq + 2, std::memory_order_release);  // Even again: buffer is complete
+    epoch.store(next, std::memory_order_release);
+}
+
+// Copy the latest published field; retry if a writer reused that buffer while we were copying
+void KnowledgeMap::snapshot(DistanceSnapshot& out) const {
+    while (true) {
+        unsigned long e = epoch.load(std::memory_order_acquire);
+        int buffer = static_cast<int>(e % 2);
+
+        unsigned before = sequence[buffer].load(std::memory_order_acquire);
+        if (before & 1) continue;  // Writer is inside this buffer
+
+        for (int i = 0; i < MAP_CELLS; ++i) {
+            out.distance[i] = distances[buffer][i].load(std::memory_order_relaxed);
+        }
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (sequence[buffer].load(std::memory_order_relaxed) == before) {
+            out.epoch = e;
+            return;
+        }
+    }
+}
+
+// Pick the open direction leading to the lowest distance in a snapshot
+int KnowledgeMap::getBestMove(const DistanceSnapshot& snap, int x, int y) const {
+    int best = -1;
+    int minDistance = snap.at(x, y);
+
+    for (int dir = UP; dir <= LEFT; ++dir) {
+        if (isWall(x, y, static_cast<Direction>(dir))) continue;
+
+        int nx = x + (dir == RIGHT) - (dir == LEFT);
+        int ny = y + (dir == DOWN) - (dir == UP);
+        if (nx < 0 || nx >= SIZE || ny < 0 || ny >= SIZE) continue;
+
+        if (snap.at(nx, ny) < minDistance) {
+            minDistance = snap.at(nx, ny);
+            best = dir;
+        }
+    }
+
+    return best;
+}
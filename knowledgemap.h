@@ -0,0 +1,50 @@
+// This header file defines the KnowledgeMap class, a maze map shared by several robots running on their own threads.
+// Walls are stored as atomic bitfields, so any robot can publish a discovered wall without locking.
+// Distances live in two epoch-versioned buffers: a reflood writes the spare buffer and then publishes it,
+// so readers always copy a complete flood snapshot while another thread refloods.
+
+#ifndef KNOWLEDGEMAP_H
+#define KNOWLEDGEMAP_H
+
+#include "maze.h"
+#include <array>
+#include <atomic>
+#include <mutex>
+
+const int MAP_CELLS = SIZE * SIZE;  // Number of cells in the shared map
+
+// A consistent copy of one published distance field
+struct DistanceSnapshot {
+    std::array<int, MAP_CELLS> distance;   // Distance from the goal per cell (INT_MAX if unreachable)
+    unsigned long epoch;                   // Epoch of the flood this copy came from
+
+    int at(int x, int y) const { return distance[y * SIZE + x]; }
+};
+
+class KnowledgeMap {
+public:
+    KnowledgeMap(int goalX, int goalY);  // Empty map (perimeter walls only) flooded towards the goal
+
+    bool setWall(int x, int y, Direction dir);       // Publish a wall on both sides, returns true if it was new
+    bool isWall(int x, int y, Direction dir) const;  // Check if a wall is known at (x, y) in a given direction
+    void reflood();                                  // Recompute distances from the known walls and publish them
+    void snapshot(DistanceSnapshot& out) const;      // Copy the latest published distances (lock-free, retries on overlap)
+    int getBestMove(const DistanceSnapshot& snap, int x, int y) const;  // Open direction with lowest distance, -1 if none is lower
+
+    unsigned long getEpoch() const { return epoch.load(std::memory_order_acquire); }  // Latest published flood
+    unsigned long getWallVersion() const { return wallVersion.load(std::memory_order_acquire); }  // Bumped on every new wall
+
+private:
+    void floodInto(std::array<int, MAP_CELLS>& distance) const;  // BFS from the goal over the known walls
+
+    int goal;                                              // Goal cell index
+    std::array<std::atomic<uint8_t>, MAP_CELLS> walls;     // One wall bit per Direction per cell
+    std::atomic<unsigned long> wallVersion;                // Number of walls published so far
+
+    std::array<std::atomic<int>, MAP_CELLS> distances[2];  // Double-buffered distance fields
+    std::atomic<unsigned> sequence[2];                     // Per-buffer sequence, odd while being rewritten
+    std::atomic<unsigned long> epoch;                      // Published epoch, buffer in use is epoch % 2
+    std::mutex writerMutex;                                // Serializes refloods only, never taken by readers
+};
+
+#endif // KNOWLEDGEMAP_H
@@ -5,12 +5,16 @@
 #include "maze.h"
 #include "robot.h"
 
+const char* CHECKPOINT_FILE = "maze.ckpt";
+
 int main() {
     Maze maze;
+    bool resumed = maze.loadCheckpoint(CHECKPOINT_FILE);  // Reuse walls and distances from the last run
     Robot robot(maze); 
     maze.display(); 
-    Floodfill floodfill(maze); 
+    Floodfill floodfill(maze, !resumed); 
     robot.solveMaze(floodfill);
+    maze.saveCheckpoint(CHECKPOINT_FILE);
     
     return 0;
 }
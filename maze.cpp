@@ -3,8 +3,36 @@
 //  The maze handles initialization, walls, robot tracking, and display.
 
 #include <iostream>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 #include "maze.h"
 
+// On-disk checkpoint layout: one header followed by SIZE * SIZE cell records (row by row)
+const char CHECKPOINT_MAGIC[4] = { 'F', 'F', 'C', 'P' };
+const uint32_t CHECKPOINT_VERSION = 1;
+
+struct CheckpointHeader {
+    char magic[4];          // "FFCP"
+    uint32_t version;       // CHECKPOINT_VERSION
+    uint32_t size;          // Maze size the checkpoint was taken from
+    int32_t start[2];       // Start cell (x, y)
+    int32_t target[2];      // Target cell (x, y)
+};
+
+struct CheckpointCell {
+    uint8_t walls;          // One bit per Direction
+    uint8_t visited;        // Visited flag
+    uint8_t type;           // CELL_TYPE
+    uint8_t reserved;       // Padding, always 0
+    int32_t distance;       // Distance from the goal
+    int32_t startDistance;  // Distance from the start
+};
+
 // Constructor: Initialize maze pointers and setup grid
 Maze::Maze() : start(nullptr), target(nullptr), robot(nullptr) {
     initMaze();
@@ -59,6 +87,7 @@ void Maze::initMaze() {
 
             // Set Manhattan distance to the target
             grid[y][x].distance = std::abs(x - centerX) + std::abs(y - centerY);
+            grid[y][x].startDistance = std::abs(x - startPosX) + std::abs(y - startPosY);  // And to the start
 
             // Assign neighbors if within bounds
             if (y > 0) grid[y][x].neighbors[UP] = &grid[y - 1][x];
@@ -69,31 +98,57 @@ void Maze::initMaze() {
     }
 
     setPerimeterWalls();  // Add boundary walls
+    connectivity.reset(&grid[0][0], SIZE);  // Whole grid starts as one region
+    corridors.reset(&grid[0][0], SIZE, start, target);  // Classify cells and collapse corridors
 }
 
 // Add or remove a wall at a given cell and direction, sync with neighbor
 void Maze::setWall(int x, int y, Direction dir, bool exists) {
-    getCell(x, y)->setWall(dir, exists);  // Set wall for this cell
+    connectivity.clearLastCut();  // Only report regions cut off by this change
+    Cell* cell = getCell(x, y);
+    bool wasOpen = cell->canMove(dir);
+    cell->setWall(dir, exists);  // Set wall for this cell
 
-    Cell* neighbor = getCell(x, y)->neighbors[dir];
+    // Find the neighbor from the coordinates: the link pointer is null once a wall was added
+    int nx = x + (dir == RIGHT) - (dir == LEFT);
+    int ny = y + (dir == DOWN) - (dir == UP);
+    if (nx < 0 || nx >= SIZE || ny < 0 || ny >= SIZE) return;  // Perimeter wall, no neighbor
+    Cell* neighbor = getCell(nx, ny);
 
-    if (neighbor) {
-        Direction oppositeDir = static_cast<Direction>((dir + 2) % 4);  // Get opposite direction
-        neighbor->setWall(oppositeDir, exists);  // Sync neighbor wall
+    Direction oppositeDir = static_cast<Direction>((dir + 2) % 4);  // Get opposite direction
+    neighbor->setWall(oppositeDir, exists);  // Sync neighbor wall
 
-        if (exists) {
-            // Break neighbor connections if wall is added
+    if (exists) {
+        // Break neighbor connections if wall is added
+        if (wasOpen) {
             std::cout << "Breaking connection between (" << x << ", " << y << ") and its neighbor in direction " << dir << "\n";
-            getCell(x, y)->neighbors[dir] = nullptr;
-            neighbor->neighbors[oppositeDir] = nullptr;
-        } else {
-            // Restore connection if wall removed
-            getCell(x, y)->neighbors[dir] = neighbor;
-            neighbor->neighbors[oppositeDir] = getCell(x, y);
         }
+        cell->neighbors[dir] = nullptr;
+        neighbor->neighbors[oppositeDir] = nullptr;
+    } else {
+        // Restore connection if wall removed
+        cell->neighbors[dir] = neighbor;
+        neighbor->neighbors[oppositeDir] = cell;
+    }
+
+    if (wasOpen != cell->canMove(dir)) {
+        connectivity.passageChanged(cell, neighbor);  // Merge or split regions
+        corridors.passageChanged(cell, neighbor);  // Re-trace the corridors around both cells
     }
 }
 
+// Set the starting cell (it stays a node of the corridor graph)
+void Maze::setStart(Cell* newStart) {
+    start = newStart;
+    corridors.setEndpoints(start, target);
+}
+
+// Set the target cell (it stays a node of the corridor graph)
+void Maze::setTarget(Cell* newTarget) {
+    target = newTarget;
+    corridors.setEndpoints(start, target);
+}
+
 // Check if there's a wall at (x, y) in the given direction
 bool Maze::isWall(int x, int y, Direction dir) const {
     return grid[y][x].isWall(dir);
@@ -156,4 +211,110 @@ void Maze::display() const {
     for (int x = 0; x < SIZE; ++x)
         std::cout << "---+";
     std::cout << std::endl;
-}
\ No newline at end of file
+}
+
+// Write the checkpoint to a temporary file and rename it over the old one, so readers never see a partial file
+bool Maze::saveCheckpoint(const char* fileName) const {
+    std::string tempName = std::string(fileName) + ".tmp";
+    int fd = open(tempName.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) {
+        std::cout << "Error: could not write checkpoint " << tempName << "\n";
+        return false;
+    }
+
+    CheckpointHeader header;
+    std::memcpy(header.magic, CHECKPOINT_MAGIC, sizeof(header.magic));
+    header.version = CHECKPOINT_VERSION;
+    header.size = SIZE;
+    header.start[0] = start->pos[0];
+    header.start[1] = start->pos[1];
+    header.target[0] = target->pos[0];
+    header.target[1] = target->pos[1];
+
+    CheckpointCell cells[SIZE * SIZE];
+    for (int y = 0; y < SIZE; ++y) {
+        for (int x = 0; x < SIZE; ++x) {
+            const Cell& cell = grid[y][x];
+            CheckpointCell& record = cells[y * SIZE + x];
+            record.walls = 0;
+            for (Direction dir : {UP, RIGHT, DOWN, LEFT}) {
+                if (cell.isWall(dir)) record.walls |= static_cast<uint8_t>(1 << dir);
+            }
+            record.visited = cell.visited ? 1 : 0;
+            record.type = static_cast<uint8_t>(cell.type);
+            record.reserved = 0;
+            record.distance = cell.distance;
+            record.startDistance = cell.startDistance;
+        }
+    }
+
+    bool ok = write(fd, &header, sizeof(header)) == static_cast<ssize_t>(sizeof(header)) &&
+              write(fd, cells, sizeof(cells)) == static_cast<ssize_t>(sizeof(cells)) &&
+              fsync(fd) == 0;
+    ok = close(fd) == 0 && ok;
+
+    if (!ok || std::rename(tempName.c_str(), fileName) != 0) {
+        std::cout << "Error: could not write checkpoint " << fileName << "\n";
+        unlink(tempName.c_str());
+        return false;
+    }
+    return true;
+}
+
+// Map a checkpoint file and copy its walls, visits, types and distances into the grid
+bool Maze::loadCheckpoint(const char* fileName) {
+    int fd = open(fileName, O_RDONLY);
+    if (fd < 0) return false;  // No checkpoint yet
+
+    struct stat info;
+    size_t expected = sizeof(CheckpointHeader) + sizeof(CheckpointCell) * SIZE * SIZE;
+    if (fstat(fd, &info) != 0 || static_cast<size_t>(info.st_size) != expected) {
+        std::cout << "Ignoring checkpoint " << fileName << ": unexpected file size\n";
+        close(fd);
+        return false;
+    }
+
+    void* data = mmap(nullptr, expected, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED) return false;
+
+    const CheckpointHeader* header = static_cast<const CheckpointHeader*>(data);
+    const CheckpointCell* cells = reinterpret_cast<const CheckpointCell*>(header + 1);
+
+    bool valid = std::memcmp(header->magic, CHECKPOINT_MAGIC, sizeof(header->magic)) == 0 &&
+                 header->version == CHECKPOINT_VERSION && header->size == static_cast<uint32_t>(SIZE);
+    for (int i = 0; valid && i < 2; ++i) {
+        valid = header->start[i] >= 0 && header->start[i] < SIZE && header->target[i] >= 0 && header->target[i] < SIZE;
+    }
+    if (!valid) {
+        std::cout << "Ignoring checkpoint " << fileName << ": wrong format or maze size\n";
+        munmap(data, expected);
+        return false;
+    }
+
+    for (int y = 0; y < SIZE; ++y) {
+        for (int x = 0; x < SIZE; ++x) {
+            const CheckpointCell& record = cells[y * SIZE + x];
+
+            // Add or remove walls through setWall so neighbor links, regions and corridors stay in sync
+            for (Direction dir : {UP, RIGHT, DOWN, LEFT}) {
+                bool exists = (record.walls >> dir) & 1;
+                if (exists != grid[y][x].isWall(dir) && !grid[y][x].isBoundaryWall(dir)) {
+                    setWall(x, y, dir, exists);
+                }
+            }
+
+            grid[y][x].visited = record.visited != 0;
+            grid[y][x].type = record.type <= EXPLORED ? static_cast<CELL_TYPE>(record.type) : UNEXPLORED;
+            grid[y][x].distance = record.distance;
+            grid[y][x].startDistance = record.startDistance;
+        }
+    }
+
+    setStart(&grid[header->start[1]][header->start[0]]);
+    setTarget(&grid[header->target[1]][header->target[0]]);
+
+    munmap(data, expected);
+    std::cout << "Resumed from checkpoint " << fileName << "\n";
+    return true;
+}
@@ -2,6 +2,8 @@
 #define MAZE_H
 
 #include "cell.h"             
+#include "connectivity.h"
+#include "corridorgraph.h"
 #include <vector>    
 #include "robot.h"            
 
@@ -15,6 +17,8 @@ private:
     Cell* start;   // Pointer to the start cell
     Cell* target;  // Pointer to the target (goal) cell
     Cell* robot;   // Pointer to the robot's current cell
+    Connectivity connectivity;  // Region labels kept up to date by setWall
+    CorridorGraph corridors;    // Junction graph kept up to date by setWall, setStart and setTarget
 
 public:
     Maze();  // Constructor: initializes maze structure
@@ -26,6 +30,10 @@ public:
     void resetVisits();  // Clear visited flags on all cells
     void markGoalAsVisited();  // Mark the target cell as visited
     void setRobotPosition(Cell* newRobotPos);  // Update robot's position in the maze
+    void floodFrom(Cell* source, int Cell::* field) { corridors.flood(source, field); }  // Corridor-graph flood from the start or target into a Cell field
+    bool isConnected(const Cell* a, const Cell* b) const { return connectivity.isConnected(a, b); }  // True if a path exists between two cells
+    bool isGoalReachable(const Cell* cell) const { return connectivity.isConnected(cell, target); }  // True if the target can be reached from a cell
+    const std::vector<Cell*>& getLastCutRegion() const { return connectivity.getLastCutRegion(); }  // Cells cut off by the last wall, empty if none
 
     // ----------- Getters -----------
     Cell* getStart() const { return start; }  // Get the starting cell
@@ -35,10 +43,14 @@ public:
     Cell* getCell(int x, int y) { return &grid[y][x]; }  // Get the cell at position (x, y)
 
     // ----------- Setters -----------
-    void setStart(Cell* newStart) { start = newStart; }  // Set the starting cell
-    void setTarget(Cell* newTarget) { target = newTarget; }  // Set the target (goal) cell
+    void setStart(Cell* newStart);  // Set the starting cell
+    void setTarget(Cell* newTarget);  // Set the target (goal) cell
 
     void display() const;  // Print the maze grid to the terminal
+
+    // ----------- Checkpoints -----------
+    bool saveCheckpoint(const char* fileName) const;  // Atomically write walls, visits, types and distances to a binary file
+    bool loadCheckpoint(const char* fileName);        // Restore a checkpoint written by saveCheckpoint (mmap), false if missing or invalid
 };
 
 #endif  // MAZE_H
@@ -4,6 +4,7 @@
 
 #include "robot.h"
 #include "floodfill/floodfill.h"
+#include "knowledgemap.h"
 #include <iostream>
 #include <algorithm>  
 
@@ -58,7 +59,10 @@ void Robot::solveMaze(Floodfill& floodfill) {
               << current->pos[0] << ", " << current->pos[1] << ")\n";
 
     // Try to compute a path to the goal
-    if (!floodfill.computePath(*this, current)) {
+    bool reached = floodfill.computePath(*this, current);
+    std::cout << "Worst step latency: " << floodfill.getWorstStepLatency().count() << " us\n";
+
+    if (!reached) {
         std::cout << "Navigation failed: Robot is trapped or no valid path found.\n";
         return;  // Stop if no valid path found
     }
@@ -69,21 +73,51 @@ void Robot::solveMaze(Floodfill& floodfill) {
     returnToStart(floodfill);  // Return to the start after reaching the goal
 }
 
-// Move the robot back to the start following the reverse path
+// Move the robot back to the start along the shortest known route
 void Robot::returnToStart(Floodfill& floodfill) {
     std::cout << "Returning to start...\n";
 
-    auto path = floodfill.getPath();  // Get the existing path to goal
-    std::reverse(path.begin(), path.end());  // Reverse it to return to start
+    if (floodfill.computeReturnPath(*this, getPosition())) {
+        std::cout << "Robot returned back to the start cell" << std::endl;
+    } else {
+        std::cout << "Return failed: no known route back to the start.\n";
+    }
+
+    floodfill.displayPath();  // Show the path taken
+}
+
+// Walk to the goal using the shared map: publish the walls seen at each cell, steer by the latest
+// published flood and reflood only when new walls were found or the snapshot offers no way down
+bool Robot::exploreShared(KnowledgeMap& map) {
+    DistanceSnapshot snap;
+    Cell* current = getPosition();
 
-    for (auto cell : path) {
-        move(cell);  // Move to each cell in the path
+    while (current != maze.getTarget()) {
+        int x = current->pos[0], y = current->pos[1];
 
-        if (cell == maze.getStart()) {  // Check if we’ve reached the start
-            std::cout << "Robot returned back to the start cell" << std::endl;
-            break;
+        bool newWalls = false;
+        for (Direction dir : {UP, RIGHT, DOWN, LEFT}) {
+            if (current->isWall(dir)) {
+                newWalls |= map.setWall(x, y, dir);  // Share what this robot sees
+            }
         }
+        if (newWalls) {
+            map.reflood();
+        }
+
+        map.snapshot(snap);
+        int dir = map.getBestMove(snap, x, y);
+
+        if (dir < 0) {
+            map.reflood();  // Walls published by other robots are not in this flood yet
+            map.snapshot(snap);
+            dir = map.getBestMove(snap, x, y);
+            if (dir < 0) return false;  // Goal unreachable from here
+        }
+
+        setPosition(current->neighbors[dir]);
+        current = getPosition();
     }
 
-    floodfill.displayPath();  // Show the path taken
-}
\ No newline at end of file
+    return true;
+}
@@ -11,6 +11,7 @@
 
 class Floodfill;  
 class Maze;       
+class KnowledgeMap;
 
 class Robot {
 private:
@@ -28,6 +29,9 @@ public:
     // Uses Floodfill to return the robot to the starting cell
     void returnToStart(Floodfill& floodfill);
 
+    // Explores towards the goal using a map shared with other robots (safe to run on its own thread)
+    bool exploreShared(KnowledgeMap& map);
+
     // Moves the robot to the specified next cell
     void move(Cell* nextCell);
 
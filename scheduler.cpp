@@ -0,0 +1,53 @@
+// This file implements the Scheduler class declared in scheduler.h.
+// It drives robots in round-robin order using Floodfill::nextMove, so the cost of one step
+// is the flood-fill work of one move per robot.
+
+#include "scheduler.h"
+#include "floodfill/floodfill.h"
+
+// Register a robot and its planner
+void Scheduler::addRobot(Robot& robot, Floodfill& floodfill) {
+    if (robot.getPosition() == floodfill.getMaze().getTarget()) {
+        tasks.push_back(Task{ &robot, &floodfill, REACHED });  // Nothing left to do
+        ++reached;
+        return;
+    }
+
+    tasks.push_back(Task{ &robot, &floodfill, RUNNING });
+    ++running;
+}
+
+// Advance each running robot by one move
+int Scheduler::step() {
+    for (Task& task : tasks) {
+        if (task.state != RUNNING) continue;
+
+        Cell* current = task.robot->getPosition();
+        Cell* nextCell = task.floodfill->nextMove(current);
+
+        if (!nextCell) {
+            task.state = FAILED;  // Trapped or no valid path found
+            --running;
+            ++failed;
+            continue;
+        }
+        if (nextCell == current) continue;  // Waiting for its reflood to finish
+
+        task.robot->setPosition(nextCell);  // Quiet move: no redraw
+
+        if (nextCell == task.floodfill->getMaze().getTarget()) {
+            task.floodfill->addToPath(nextCell);  // Add target to path
+            task.state = REACHED;
+            --running;
+            ++reached;
+        }
+    }
+
+    return running;
+}
+
+// Step until no robot is left running
+void Scheduler::run() {
+    while (step() > 0) {
+    }
+}
@@ -0,0 +1,44 @@
+// This header file defines the Scheduler class, which runs many robot simulations on one thread.
+// Each registered robot has its own Maze and Floodfill. On every step the scheduler advances each
+// unfinished robot by exactly one move, without sleeping, reading input or redrawing the maze.
+
+#ifndef SCHEDULER_H
+#define SCHEDULER_H
+
+#include <vector>
+#include "robot.h"
+
+class Floodfill;
+class Robot;
+
+class Scheduler {
+public:
+    // Register a robot and the Floodfill instance that guides it
+    void addRobot(Robot& robot, Floodfill& floodfill);
+
+    // Advance every unfinished robot by one move, returns how many are still running
+    int step();
+
+    // Keep stepping until every robot has reached its goal or got stuck
+    void run();
+
+    int getRunning() const { return running; }    // Robots still on their way
+    int getReached() const { return reached; }    // Robots that reached their goal
+    int getFailed() const { return failed; }      // Robots that got trapped
+
+private:
+    enum TaskState { RUNNING, REACHED, FAILED };
+
+    struct Task {
+        Robot* robot;           // Robot being driven
+        Floodfill* floodfill;   // Its path planner
+        TaskState state;        // Whether it still needs steps
+    };
+
+    std::vector<Task> tasks;    // All registered robots, visited round-robin
+    int running = 0;
+    int reached = 0;
+    int failed = 0;
+};
+
+#endif // SCHEDULER_H
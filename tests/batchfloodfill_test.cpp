@@ -0,0 +1,95 @@
+// Checks every lane of the batched flood against Floodfill::updateFloodValues on the same maze.
+// Build and run from the repository root:
+//   g++ -std=c++17 -I. tests/batchfloodfill_test.cpp cell.cpp maze.cpp robot.cpp connectivity.cpp corridorgraph.cpp knowledgemap.cpp floodfill/floodfill.cpp floodfill/batchfloodfill.cpp -o batchfloodfill_test && ./batchfloodfill_test
+
+#include "floodfill/batchfloodfill.h"
+#include "floodfill/floodfill.h"
+#include <cassert>
+#include <climits>
+#include <cstdlib>
+#include <iostream>
+
+// Scalar result of one maze, kept while the batch overwrites the cells
+struct Expected {
+    int distance[SIZE * SIZE];
+    int startDistance[SIZE * SIZE];
+    Cell* previous[SIZE * SIZE];
+};
+
+// Random walls, some of them removed again, and sometimes moved endpoints
+static void randomMaze(Maze& maze) {
+    for (int wall = 0; wall < 25; ++wall) {
+        bool exists = std::rand() % 4 != 0;
+        maze.setWall(std::rand() % SIZE, std::rand() % SIZE, static_cast<Direction>(std::rand() % 4), exists);
+    }
+    if (std::rand() % 3 == 0) maze.setTarget(maze.getCell(std::rand() % SIZE, std::rand() % SIZE));
+    if (std::rand() % 3 == 0) maze.setStart(maze.getCell(std::rand() % SIZE, std::rand() % SIZE));
+}
+
+// Sixteen different mazes per batch, compared lane by lane
+static void randomBatches() {
+    std::srand(11);
+    int lanes = 0;
+    for (int run = 0; run < 200; ++run) {
+        Maze mazes[BATCH_LANES];
+        Expected expected[BATCH_LANES];
+        BatchFloodfill batch;
+
+        for (int lane = 0; lane < BATCH_LANES; ++lane) {
+            randomMaze(mazes[lane]);
+            Floodfill floodfill(mazes[lane]);  // Floods both fields and links previous
+            for (int cell = 0; cell < SIZE * SIZE; ++cell) {
+                Cell* c = mazes[lane].getCell(cell % SIZE, cell / SIZE);
+                expected[lane].distance[cell] = c->distance;
+                expected[lane].startDistance[cell] = c->startDistance;
+                expected[lane].previous[cell] = c->previous;
+            }
+            batch.loadMaze(lane, mazes[lane]);
+        }
+        batch.updateFloodValues();
+
+        for (int lane = 0; lane < BATCH_LANES; ++lane) {
+            // Scramble the cells so storeDistances has to rewrite every field
+            for (int cell = 0; cell < SIZE * SIZE; ++cell) {
+                Cell* c = mazes[lane].getCell(cell % SIZE, cell / SIZE);
+                c->distance = c->startDistance = -1;
+                c->previous = c;
+            }
+            batch.storeDistances(lane, mazes[lane]);
+
+            for (int cell = 0; cell < SIZE * SIZE; ++cell) {
+                int x = cell % SIZE, y = cell / SIZE;
+                Cell* c = mazes[lane].getCell(x, y);
+                assert(batch.getDistance(lane, x, y) == expected[lane].distance[cell]);
+                assert(batch.getStartDistance(lane, x, y) == expected[lane].startDistance[cell]);
+                assert(c->distance == expected[lane].distance[cell]);
+                assert(c->startDistance == expected[lane].startDistance[cell]);
+                assert(c->previous == expected[lane].previous[cell]);
+            }
+            lanes++;
+        }
+    }
+    std::cout << "random batches: " << lanes << " lanes ok\n";
+}
+
+// An empty lane reaches nothing, a loaded one next to it is unaffected
+static void clearedLane() {
+    Maze maze;
+    BatchFloodfill batch;
+    batch.loadMaze(0, maze);
+    batch.loadMaze(1, maze);
+    batch.clearLane(1);
+    batch.updateFloodValues();
+
+    assert(batch.getDistance(0, 0, 0) == SIZE / 2 * 2);
+    for (int y = 0; y < SIZE; ++y)
+        for (int x = 0; x < SIZE; ++x)
+            assert(batch.getDistance(1, x, y) == INT_MAX && batch.getStartDistance(1, x, y) == INT_MAX);
+    std::cout << "cleared lane ok\n";
+}
+
+int main() {
+    randomBatches();
+    clearedLane();
+    return 0;
+}
@@ -0,0 +1,183 @@
+// Checks that a checkpoint round-trips the explored state and that damaged files are rejected untouched.
+// Build and run from the repository root:
+//   g++ -std=c++17 -I. tests/checkpoint_test.cpp cell.cpp maze.cpp connectivity.cpp corridorgraph.cpp -o checkpoint_test && ./checkpoint_test
+
+#include "maze.h"
+#include <cassert>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <unistd.h>
+
+// Random walls (some removed again), visits, types, distances and endpoints
+static void randomState(Maze& maze) {
+    for (int wall = 0; wall < 20; ++wall) {
+        int x = std::rand() % SIZE, y = std::rand() % SIZE;
+        Direction dir = static_cast<Direction>(std::rand() % 4);
+        if (!maze.getCell(x, y)->isBoundaryWall(dir)) maze.setWall(x, y, dir, std::rand() % 4 != 0);
+    }
+    maze.setStart(maze.getCell(std::rand() % SIZE, std::rand() % SIZE));
+    maze.setTarget(maze.getCell(std::rand() % SIZE, std::rand() % SIZE));
+
+    for (int y = 0; y < SIZE; ++y) {
+        for (int x = 0; x < SIZE; ++x) {
+            Cell* cell = maze.getCell(x, y);
+            cell->visited = std::rand() % 2 == 0;
+            cell->type = cell->visited ? EXPLORED : UNEXPLORED;
+            cell->distance = std::rand() % 100;
+            cell->startDistance = std::rand() % 100;
+        }
+    }
+    maze.getStart()->type = START;
+    maze.getTarget()->type = TARGET;
+}
+
+// Every restored field, plus regions and corridor floods that must follow the restored walls
+static void checkSame(Maze& saved, Maze& loaded) {
+    assert(saved.getStart()->pos[0] == loaded.getStart()->pos[0] && saved.getStart()->pos[1] == loaded.getStart()->pos[1]);
+    assert(saved.getTarget()->pos[0] == loaded.getTarget()->pos[0] && saved.getTarget()->pos[1] == loaded.getTarget()->pos[1]);
+
+    for (int y = 0; y < SIZE; ++y) {
+        for (int x = 0; x < SIZE; ++x) {
+            Cell* a = saved.getCell(x, y);
+            Cell* b = loaded.getCell(x, y);
+            for (Direction dir : {UP, RIGHT, DOWN, LEFT}) {
+                assert(a->isWall(dir) == b->isWall(dir));
+                assert(a->canMove(dir) == b->canMove(dir));
+            }
+            assert(a->visited == b->visited);
+            assert(a->type == b->type);
+            assert(a->distance == b->distance);
+            assert(a->startDistance == b->startDistance);
+        }
+    }
+
+    for (int i = 0; i < SIZE * SIZE; ++i) {
+        for (int j = 0; j < SIZE * SIZE; ++j) {
+            assert(saved.isConnected(saved.getCell(i % SIZE, i / SIZE), saved.getCell(j % SIZE, j / SIZE)) ==
+                   loaded.isConnected(loaded.getCell(i % SIZE, i / SIZE), loaded.getCell(j % SIZE, j / SIZE)));
+        }
+    }
+
+    // The corridor graphs must flood alike; the restored fields are put back afterwards
+    int distance[SIZE * SIZE], startDistance[SIZE * SIZE];
+    for (int i = 0; i < SIZE * SIZE; ++i) {
+        distance[i] = saved.getCell(i % SIZE, i / SIZE)->distance;
+        startDistance[i] = saved.getCell(i % SIZE, i / SIZE)->startDistance;
+    }
+    saved.floodFrom(saved.getTarget(), &Cell::distance);
+    saved.floodFrom(saved.getStart(), &Cell::startDistance);
+    loaded.floodFrom(loaded.getTarget(), &Cell::distance);
+    loaded.floodFrom(loaded.getStart(), &Cell::startDistance);
+    for (int y = 0; y < SIZE; ++y) {
+        for (int x = 0; x < SIZE; ++x) {
+            assert(saved.getCell(x, y)->distance == loaded.getCell(x, y)->distance);
+            assert(saved.getCell(x, y)->startDistance == loaded.getCell(x, y)->startDistance);
+        }
+    }
+    for (int i = 0; i < SIZE * SIZE; ++i) {
+        saved.getCell(i % SIZE, i / SIZE)->distance = loaded.getCell(i % SIZE, i / SIZE)->distance = distance[i];
+        saved.getCell(i % SIZE, i / SIZE)->startDistance = loaded.getCell(i % SIZE, i / SIZE)->startDistance = startDistance[i];
+    }
+}
+
+// Save random mazes and load them into fresh mazes and into mazes that already hold other walls
+static void roundTrip(const char* fileName) {
+    std::srand(13);
+    for (int run = 0; run < 200; ++run) {
+        Maze saved;
+        randomState(saved);
+        assert(saved.saveCheckpoint(fileName));
+        assert(access((std::string(fileName) + ".tmp").c_str(), F_OK) != 0);  // Renamed into place
+
+        Maze fresh;
+        assert(fresh.loadCheckpoint(fileName));
+        checkSame(saved, fresh);
+
+        Maze reused;
+        randomState(reused);  // Walls the checkpoint does not have must be removed
+        assert(reused.loadCheckpoint(fileName));
+        checkSame(saved, reused);
+    }
+    std::cout << "round trip ok\n";
+}
+
+// Write raw bytes over a checkpoint file
+static void writeFile(const char* fileName, const std::string& bytes) {
+    std::FILE* file = std::fopen(fileName, "wb");
+    assert(file);
+    assert(std::fwrite(bytes.data(), 1, bytes.size(), file) == bytes.size());
+    std::fclose(file);
+}
+
+// A rejected checkpoint leaves the maze exactly as it was
+static void checkRejected(const char* fileName, const std::string& bytes) {
+    writeFile(fileName, bytes);
+    Maze maze;
+    Maze untouched;
+    assert(!maze.loadCheckpoint(fileName));
+    checkSame(untouched, maze);
+}
+
+// Wrong size, wrong magic, unknown version, wrong maze size and out-of-range endpoints
+static void rejections(const char* fileName) {
+    Maze saved;
+    saved.setWall(1, 1, RIGHT, true);
+    assert(saved.saveCheckpoint(fileName));
+
+    std::FILE* file = std::fopen(fileName, "rb");
+    assert(file);
+    std::string good;
+    char buffer[256];
+    size_t n;
+    while ((n = std::fread(buffer, 1, sizeof(buffer), file)) > 0) good.append(buffer, n);
+    std::fclose(file);
+
+    // Header layout: magic[4], version, size, start[2], target[2]
+    const size_t versionAt = 4, sizeAt = 8, startAt = 12, targetAt = 20;
+    auto patched = [&](size_t offset, int32_t value) {
+        std::string bytes = good;
+        std::memcpy(&bytes[offset], &value, sizeof(value));
+        return bytes;
+    };
+
+    checkRejected(fileName, good.substr(0, good.size() - 1));  // Truncated
+    checkRejected(fileName, good + '\0');                      // Trailing bytes
+    checkRejected(fileName, "");                                // Empty
+
+    std::string badMagic = good;
+    badMagic[0] = 'X';
+    checkRejected(fileName, badMagic);
+
+    checkRejected(fileName, patched(versionAt, 2));
+    checkRejected(fileName, patched(sizeAt, SIZE + 1));
+    checkRejected(fileName, patched(startAt, SIZE));        // Start x past the edge
+    checkRejected(fileName, patched(startAt + 4, -1));      // Start y before the edge
+    checkRejected(fileName, patched(targetAt, -1));
+    checkRejected(fileName, patched(targetAt + 4, SIZE));
+
+    // The untouched bytes still load
+    writeFile(fileName, good);
+    Maze loaded;
+    assert(loaded.loadCheckpoint(fileName));
+    checkSame(saved, loaded);
+
+    unlink(fileName);
+    Maze missing;
+    assert(!missing.loadCheckpoint(fileName));  // No file yet
+    std::cout << "rejections ok\n";
+}
+
+int main() {
+    char fileName[] = "/tmp/checkpoint_testXXXXXX";
+    int fd = mkstemp(fileName);
+    assert(fd >= 0);
+    close(fd);
+
+    roundTrip(fileName);
+    rejections(fileName);
+    return 0;
+}
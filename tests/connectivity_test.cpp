@@ -0,0 +1,180 @@
+// Checks the incremental region labels against a plain breadth-first search.
+// Build and run from the repository root:
+//   g++ -std=c++17 -I. tests/connectivity_test.cpp cell.cpp maze.cpp connectivity.cpp corridorgraph.cpp -o connectivity_test && ./connectivity_test
+
+#include "maze.h"
+#include <cassert>
+#include <climits>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+const int GRID = 6;  // Side of the stand-alone test grid
+
+// Reference: is b reachable from a over open passages of a size x size grid?
+static bool reachable(Cell* a, Cell* b, int size = GRID) {
+    std::vector<Cell*> pending = { a };
+    std::vector<bool> seen(size * size, false);
+    seen[a->pos[1] * size + a->pos[0]] = true;
+
+    for (size_t i = 0; i < pending.size(); ++i) {
+        Cell* current = pending[i];
+        if (current == b) return true;
+        for (Direction dir : {UP, RIGHT, DOWN, LEFT}) {
+            if (!current->canMove(dir)) continue;
+            Cell* neighbor = current->neighbors[dir];
+            int index = neighbor->pos[1] * size + neighbor->pos[0];
+            if (!seen[index]) {
+                seen[index] = true;
+                pending.push_back(neighbor);
+            }
+        }
+    }
+    return false;
+}
+
+// Reference: breadth-first distance between two cells of a size x size grid, -1 if unreachable
+static int pathLength(Cell* a, Cell* b, int size) {
+    std::vector<Cell*> pending = { a };
+    std::vector<int> length(size * size, -1);
+    length[a->pos[1] * size + a->pos[0]] = 0;
+
+    for (size_t i = 0; i < pending.size(); ++i) {
+        Cell* current = pending[i];
+        int here = length[current->pos[1] * size + current->pos[0]];
+        if (current == b) return here;
+        for (Direction dir : {UP, RIGHT, DOWN, LEFT}) {
+            if (!current->canMove(dir)) continue;
+            Cell* neighbor = current->neighbors[dir];
+            int index = neighbor->pos[1] * size + neighbor->pos[0];
+            if (length[index] == -1) {
+                length[index] = here + 1;
+                pending.push_back(neighbor);
+            }
+        }
+    }
+    return -1;
+}
+
+// Open or close the passage between a cell and its neighbor, the way Maze::setWall links cells
+static void setPassage(std::vector<Cell>& grid, int x, int y, Direction dir, bool open) {
+    int nx = x + (dir == RIGHT) - (dir == LEFT);
+    int ny = y + (dir == DOWN) - (dir == UP);
+    if (nx < 0 || nx >= GRID || ny < 0 || ny >= GRID) return;
+
+    Cell* a = &grid[y * GRID + x];
+    Cell* b = &grid[ny * GRID + nx];
+    Direction back = a->oppositeDir(dir);
+    a->walls[dir] = !open;
+    b->walls[back] = !open;
+    a->neighbors[dir] = open ? b : nullptr;
+    b->neighbors[back] = open ? a : nullptr;
+}
+
+// Random opens and closes on a stand-alone grid, so merges are exercised too
+static void randomPassages() {
+    std::srand(9);
+    int queries = 0;
+    for (int run = 0; run < 500; ++run) {
+        std::vector<Cell> grid;
+        for (int i = 0; i < GRID * GRID; ++i) grid.push_back(Cell(i % GRID, i / GRID));
+        for (int y = 0; y < GRID; ++y)
+            for (int x = 0; x < GRID; ++x)
+                for (Direction dir : {RIGHT, DOWN}) setPassage(grid, x, y, dir, true);
+
+        Connectivity connectivity;
+        connectivity.reset(&grid[0], GRID);
+
+        for (int step = 0; step < 200; ++step) {
+            int x = std::rand() % GRID, y = std::rand() % GRID;
+            Direction dir = static_cast<Direction>(std::rand() % 4);
+            bool open = std::rand() % 3 == 0;
+            int nx = x + (dir == RIGHT) - (dir == LEFT);
+            int ny = y + (dir == DOWN) - (dir == UP);
+            if (nx < 0 || nx >= GRID || ny < 0 || ny >= GRID) continue;
+            Cell* cell = &grid[y * GRID + x];
+            Cell* neighbor = &grid[ny * GRID + nx];
+
+            connectivity.clearLastCut();
+            setPassage(grid, x, y, dir, open);
+            connectivity.passageChanged(cell, neighbor);
+
+            // A reported cut is one whole region, split off by closing a passage
+            const std::vector<Cell*>& cut = connectivity.getLastCutRegion();
+            if (!cut.empty()) {
+                assert(!open && !reachable(cell, neighbor));
+                assert(connectivity.getRegionSize(cut[0]) == static_cast<int>(cut.size()));
+                for (Cell* c : cut) assert(reachable(cut[0], c));
+            }
+            assert(connectivity.getLabelCount() <= GRID * GRID);
+
+            for (int k = 0; k < 8; ++k) {
+                Cell* a = &grid[std::rand() % (GRID * GRID)];
+                Cell* b = &grid[std::rand() % (GRID * GRID)];
+                assert(connectivity.isConnected(a, b) == reachable(a, b));
+                queries++;
+            }
+        }
+    }
+    std::cout << "random passages: " << queries << " queries ok\n";
+}
+
+// Maze::setWall reports a cut once; re-adding the same wall reports nothing
+static void lastCutThroughMaze() {
+    Maze maze;
+    maze.setWall(0, 0, RIGHT, true);
+    assert(maze.getLastCutRegion().empty());
+    maze.setWall(0, 0, DOWN, true);
+    assert(maze.getLastCutRegion().size() == 1);
+    assert(!maze.isGoalReachable(maze.getStart()));
+
+    maze.setWall(0, 0, DOWN, true);  // Already there
+    assert(maze.getLastCutRegion().empty());
+    std::cout << "last cut ok\n";
+}
+
+// Closing and reopening through Maze::setWall restores both wall bits, the links and the regions
+static void closeAndReopenThroughMaze() {
+    Maze maze;
+    Cell* start = maze.getStart();
+    maze.setWall(0, 0, RIGHT, true);
+    maze.setWall(0, 0, DOWN, true);
+    assert(!maze.isGoalReachable(start));
+
+    maze.setWall(0, 0, DOWN, false);
+    assert(!maze.isWall(0, 0, DOWN) && !maze.isWall(0, 1, UP));
+    assert(start->canMove(DOWN) && maze.getCell(0, 1)->canMove(UP));
+    assert(maze.isGoalReachable(start));
+    assert(maze.getLastCutRegion().empty());
+
+    maze.setWall(0, 0, RIGHT, false);
+    maze.floodFrom(maze.getTarget(), &Cell::distance);
+    assert(start->distance == SIZE / 2 * 2);  // Open grid again: Manhattan distance to the center
+
+    // Random closes and reopens, checked against the reference search
+    std::srand(17);
+    for (int step = 0; step < 2000; ++step) {
+        int x = std::rand() % SIZE, y = std::rand() % SIZE;
+        Direction dir = static_cast<Direction>(std::rand() % 4);
+        if (maze.getCell(x, y)->isBoundaryWall(dir)) continue;
+        maze.setWall(x, y, dir, std::rand() % 2 == 0);
+
+        Cell* a = maze.getCell(std::rand() % SIZE, std::rand() % SIZE);
+        Cell* b = maze.getCell(std::rand() % SIZE, std::rand() % SIZE);
+        assert(maze.isConnected(a, b) == reachable(a, b, SIZE));
+        assert(maze.isGoalReachable(start) == reachable(start, maze.getTarget(), SIZE));
+
+        // The corridor graph has to follow the same changes
+        maze.floodFrom(maze.getTarget(), &Cell::distance);
+        int expected = pathLength(a, maze.getTarget(), SIZE);
+        assert(a->distance == (expected == -1 ? INT_MAX : expected));
+    }
+    std::cout << "close and reopen ok\n";
+}
+
+int main() {
+    randomPassages();
+    lastCutThroughMaze();
+    closeAndReopenThroughMaze();
+    return 0;
+}
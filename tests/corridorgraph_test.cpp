@@ -0,0 +1,117 @@
+// Checks the corridor-graph flood against a plain breadth-first search.
+// Build and run from the repository root:
+//   g++ -std=c++17 -I. tests/corridorgraph_test.cpp cell.cpp maze.cpp robot.cpp connectivity.cpp corridorgraph.cpp knowledgemap.cpp floodfill/floodfill.cpp -o corridorgraph_test && ./corridorgraph_test
+
+#include "floodfill/floodfill.h"
+#include <cassert>
+#include <climits>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+// Reference distances from source over open passages
+static std::vector<int> bfs(Maze& maze, Cell* source) {
+    std::vector<int> distance(SIZE * SIZE, INT_MAX);
+    std::vector<Cell*> pending = { source };
+    distance[source->pos[1] * SIZE + source->pos[0]] = 0;
+
+    for (size_t i = 0; i < pending.size(); ++i) {
+        Cell* current = pending[i];
+        for (Direction dir : {UP, RIGHT, DOWN, LEFT}) {
+            if (!current->canMove(dir)) continue;
+            Cell* neighbor = current->neighbors[dir];
+            int& d = distance[neighbor->pos[1] * SIZE + neighbor->pos[0]];
+            if (d == INT_MAX) {
+                d = distance[current->pos[1] * SIZE + current->pos[0]] + 1;
+                pending.push_back(neighbor);
+            }
+        }
+    }
+    return distance;
+}
+
+// Both fields must match the BFS and every previous link must step one closer to the goal
+static void checkFields(Maze& maze) {
+    std::vector<int> toGoal = bfs(maze, maze.getTarget());
+    std::vector<int> toStart = bfs(maze, maze.getStart());
+
+    for (int y = 0; y < SIZE; ++y) {
+        for (int x = 0; x < SIZE; ++x) {
+            Cell* cell = maze.getCell(x, y);
+            assert(cell->distance == toGoal[y * SIZE + x]);
+            assert(cell->startDistance == toStart[y * SIZE + x]);
+
+            if (cell->distance == INT_MAX || cell->distance == 0) {
+                assert(cell->previous == nullptr);
+            } else {
+                assert(cell->previous != nullptr);
+                assert(cell->previous->distance == cell->distance - 1);
+            }
+        }
+    }
+}
+
+// Random wall sequences, reflooding every few walls
+static void randomWalls() {
+    std::srand(5);
+    int refloods = 0;
+    for (int run = 0; run < 2000; ++run) {
+        Maze maze;
+        Floodfill floodfill(maze);
+        checkFields(maze);
+
+        for (int wall = 0; wall < 30; ++wall) {
+            maze.setWall(std::rand() % SIZE, std::rand() % SIZE, static_cast<Direction>(std::rand() % 4), true);
+            if (std::rand() % 3 == 0) {
+                floodfill.updateFloodValues();
+                checkFields(maze);
+                refloods++;
+            }
+        }
+    }
+    std::cout << "random walls: " << refloods << " refloods ok\n";
+}
+
+// Moving the start or target onto a corridor cell must keep both fields correct
+static void movedEndpoints() {
+    Maze maze;
+    Floodfill floodfill(maze);
+
+    maze.setTarget(maze.getCell(4, 0));
+    floodfill.updateFloodValues();
+    checkFields(maze);
+    assert(maze.getCell(4, 0)->distance == 0);
+    assert(maze.getCell(0, 4)->distance == 8);
+
+    maze.setStart(maze.getCell(2, 4));
+    floodfill.updateFloodValues();
+    checkFields(maze);
+    assert(maze.getCell(2, 4)->startDistance == 0);
+
+    maze.setWall(3, 0, DOWN, true);
+    maze.setTarget(maze.getCell(3, 0));
+    floodfill.updateFloodValues();
+    checkFields(maze);
+    std::cout << "moved endpoints ok\n";
+}
+
+// Two Floodfill instances on one maze must both see every wall
+static void twoFloodfills() {
+    Maze maze;
+    Floodfill a(maze);
+    Floodfill b(maze);
+
+    a.updateFloodValues();
+    maze.setWall(1, 2, UP, true);
+    b.updateFloodValues();
+    a.updateFloodValues();
+    checkFields(maze);
+    std::cout << "two floodfills ok\n";
+}
+
+int main() {
+    randomWalls();
+    movedEndpoints();
+    twoFloodfills();
+    return 0;
+}
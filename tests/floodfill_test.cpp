@@ -0,0 +1,101 @@
+// Checks the bounded reflood: moves taken from the partial field and the fields it finally publishes.
+// Build and run from the repository root:
+//   g++ -std=c++17 -I. tests/floodfill_test.cpp cell.cpp maze.cpp robot.cpp connectivity.cpp corridorgraph.cpp knowledgemap.cpp floodfill/floodfill.cpp -o floodfill_test && ./floodfill_test
+
+#include "floodfill/floodfill.h"
+#include <cassert>
+#include <climits>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+// Reference: breadth-first distance of every cell from the target over open passages
+static std::vector<int> bfs(Maze& maze) {
+    std::vector<int> distance(SIZE * SIZE, INT_MAX);
+    std::vector<Cell*> pending = { maze.getTarget() };
+    distance[maze.getTarget()->pos[1] * SIZE + maze.getTarget()->pos[0]] = 0;
+
+    for (size_t i = 0; i < pending.size(); ++i) {
+        Cell* current = pending[i];
+        int here = distance[current->pos[1] * SIZE + current->pos[0]];
+        for (Direction dir : {UP, RIGHT, DOWN, LEFT}) {
+            if (!current->canMove(dir)) continue;
+            Cell* neighbor = current->neighbors[dir];
+            int& there = distance[neighbor->pos[1] * SIZE + neighbor->pos[0]];
+            if (there == INT_MAX) {
+                there = here + 1;
+                pending.push_back(neighbor);
+            }
+        }
+    }
+    return distance;
+}
+
+// One relaxation per step: walk to the goal on stale distances, then compare with a full flood
+static void boundedReflood() {
+    std::srand(3);
+    int refloods = 0, partialMoves = 0;
+    for (int run = 0; run < 500; ++run) {
+        Maze maze;
+        Floodfill floodfill(maze);
+        floodfill.setRefloodBudget(1, std::chrono::microseconds(0));
+
+        // New walls without a reflood leave the published field stale
+        for (int wall = 0; wall < 12; ++wall) {
+            maze.setWall(std::rand() % SIZE, std::rand() % SIZE, static_cast<Direction>(std::rand() % 4), true);
+        }
+        Cell* current = maze.getStart();
+        if (!maze.isGoalReachable(current)) continue;
+        std::vector<int> truth = bfs(maze);
+
+        bool sawReflood = false;
+        for (int step = 0; current != maze.getTarget(); ++step) {
+            assert(step < 10000);
+            Cell* next = floodfill.nextMove(current);
+            assert(next != nullptr);
+            sawReflood = sawReflood || floodfill.isRefloodPending();
+
+            if (next != current) {
+                int dir = 0;
+                while (dir < 4 && current->neighbors[dir] != next) dir++;
+                assert(dir < 4 && current->canMove(static_cast<Direction>(dir)));
+
+                // Moves made while the reflood runs must be shortest-path steps in the new maze
+                if (floodfill.isRefloodPending()) {
+                    assert(truth[next->pos[1] * SIZE + next->pos[0]] == truth[current->pos[1] * SIZE + current->pos[0]] - 1);
+                    partialMoves++;
+                }
+                current = next;
+            }
+        }
+
+        while (!floodfill.refloodStep()) {}  // Let a reflood still running at the goal publish
+
+        std::vector<int> distance, startDistance;
+        std::vector<Cell*> previous;
+        for (int cell = 0; cell < SIZE * SIZE; ++cell) {
+            Cell* c = maze.getCell(cell % SIZE, cell / SIZE);
+            distance.push_back(c->distance);
+            startDistance.push_back(c->startDistance);
+            previous.push_back(c->previous);
+        }
+
+        if (sawReflood) {
+            floodfill.updateFloodValues();
+            for (int cell = 0; cell < SIZE * SIZE; ++cell) {
+                Cell* c = maze.getCell(cell % SIZE, cell / SIZE);
+                assert(distance[cell] == c->distance);
+                assert(startDistance[cell] == c->startDistance);
+                assert(previous[cell] == c->previous);
+            }
+            refloods++;
+        }
+    }
+    assert(refloods > 0);
+    std::cout << "bounded reflood: " << refloods << " runs, " << partialMoves << " moves on the partial field ok\n";
+}
+
+int main() {
+    boundedReflood();
+    return 0;
+}
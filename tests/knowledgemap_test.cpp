@@ -0,0 +1,116 @@
+// Runs several robots on their own threads against one shared KnowledgeMap while another thread keeps reading snapshots.
+// Build and run from the repository root (add -fsanitize=thread to check for data races):
+//   g++ -std=c++17 -pthread -I. tests/knowledgemap_test.cpp cell.cpp maze.cpp robot.cpp connectivity.cpp corridorgraph.cpp knowledgemap.cpp floodfill/floodfill.cpp -o knowledgemap_test && ./knowledgemap_test
+
+#include "knowledgemap.h"
+#include "robot.h"
+#include <atomic>
+#include <cassert>
+#include <climits>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+
+const int ROBOTS = 4;
+
+struct WallSpec {
+    int x, y;
+    Direction dir;
+};
+
+// A published field is one whole flood: cells open to each other now were open then (walls are only added),
+// so their distances differ by at most one and are either both reached or both unreached
+static void checkSnapshot(const KnowledgeMap& map, const DistanceSnapshot& snap, int goalX, int goalY) {
+    assert(snap.at(goalX, goalY) == 0);
+    for (int y = 0; y < SIZE; ++y) {
+        for (int x = 0; x < SIZE; ++x) {
+            for (Direction dir : {RIGHT, DOWN}) {
+                int nx = x + (dir == RIGHT), ny = y + (dir == DOWN);
+                if (nx >= SIZE || ny >= SIZE || map.isWall(x, y, dir)) continue;
+                int a = snap.at(x, y), b = snap.at(nx, ny);
+                assert((a == INT_MAX) == (b == INT_MAX));
+                assert(a == INT_MAX || std::abs(a - b) <= 1);
+            }
+        }
+    }
+}
+
+// One round: every robot explores its own copy of the same maze, all sharing one map
+static void sharedRound(const std::vector<WallSpec>& layout, const int starts[ROBOTS][2], unsigned long& snapshots) {
+    std::vector<std::unique_ptr<Maze>> mazes;
+    std::vector<std::unique_ptr<Robot>> robots;
+    for (int i = 0; i < ROBOTS; ++i) {
+        mazes.emplace_back(new Maze());
+        for (const WallSpec& wall : layout) mazes[i]->setWall(wall.x, wall.y, wall.dir, true);
+        robots.emplace_back(new Robot(*mazes[i]));
+        robots[i]->setPosition(mazes[i]->getCell(starts[i][0], starts[i][1]));
+    }
+
+    Cell* target = mazes[0]->getTarget();
+    int goalX = target->pos[0], goalY = target->pos[1];
+    KnowledgeMap map(goalX, goalY);
+
+    std::atomic<bool> done(false);
+    std::thread reader([&]() {
+        DistanceSnapshot snap;
+        unsigned long lastEpoch = 0;
+        while (!done.load(std::memory_order_acquire)) {
+            map.snapshot(snap);
+            assert(snap.epoch >= lastEpoch);  // Epochs never go backwards
+            checkSnapshot(map, snap, goalX, goalY);
+            lastEpoch = snap.epoch;
+            snapshots++;
+        }
+    });
+
+    std::atomic<int> reached(0);
+    std::vector<std::thread> workers;
+    for (int i = 0; i < ROBOTS; ++i) {
+        workers.emplace_back([&, i]() {
+            if (robots[i]->exploreShared(map) && robots[i]->getPosition() == mazes[i]->getTarget()) {
+                reached.fetch_add(1);
+            }
+        });
+    }
+    for (std::thread& worker : workers) worker.join();
+    done.store(true, std::memory_order_release);
+    reader.join();
+
+    assert(reached.load() == ROBOTS);
+}
+
+// Random layouts where the goal stays reachable from every start
+static void randomRounds() {
+    std::srand(7);
+    unsigned long snapshots = 0;
+    int rounds = 0;
+    while (rounds < 100) {
+        Maze check;
+        std::vector<WallSpec> layout;
+        for (int wall = 0; wall < 10; ++wall) {
+            WallSpec spec = { std::rand() % SIZE, std::rand() % SIZE, static_cast<Direction>(std::rand() % 4) };
+            layout.push_back(spec);
+            check.setWall(spec.x, spec.y, spec.dir, true);
+        }
+
+        int starts[ROBOTS][2];
+        bool reachable = true;
+        for (int i = 0; i < ROBOTS; ++i) {
+            starts[i][0] = std::rand() % SIZE;
+            starts[i][1] = std::rand() % SIZE;
+            reachable = reachable && check.isGoalReachable(check.getCell(starts[i][0], starts[i][1]));
+        }
+        if (!reachable) continue;
+
+        sharedRound(layout, starts, snapshots);
+        rounds++;
+    }
+    std::cout << "shared exploration: " << rounds << " rounds, " << snapshots << " snapshots ok\n";
+}
+
+int main() {
+    randomRounds();
+    return 0;
+}
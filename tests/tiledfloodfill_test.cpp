@@ -0,0 +1,99 @@
+// Checks the out-of-core flood against a plain in-memory BFS, with a tiny frontier chunk so the queue spills constantly.
+// Build and run from the repository root:
+//   g++ -std=c++17 -I. tests/tiledfloodfill_test.cpp cell.cpp tiledmaze.cpp floodfill/queue.cpp floodfill/tiledfloodfill.cpp -o tiledfloodfill_test && ./tiledfloodfill_test
+
+#include "floodfill/tiledfloodfill.h"
+#include <cassert>
+#include <climits>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+#include <unistd.h>
+
+const int WIDTH = 300;   // Several tiles across, not a multiple of TILE_DIM
+const int HEIGHT = 200;
+
+// Reference maze: one wall byte per cell, same bit layout as the tiles
+struct PlainMaze {
+    std::vector<unsigned char> walls = std::vector<unsigned char>(WIDTH * HEIGHT, 0);
+
+    bool canMove(int x, int y, Direction dir, int& nx, int& ny) const {
+        nx = x + (dir == RIGHT) - (dir == LEFT);
+        ny = y + (dir == DOWN) - (dir == UP);
+        if (nx < 0 || nx >= WIDTH || ny < 0 || ny >= HEIGHT) return false;
+        return !((walls[y * WIDTH + x] >> dir) & 1);
+    }
+
+    std::vector<int> bfs(int goalX, int goalY) const {
+        std::vector<int> distance(WIDTH * HEIGHT, INT_MAX);
+        std::vector<int> pending = { goalY * WIDTH + goalX };
+        distance[pending[0]] = 0;
+        for (size_t i = 0; i < pending.size(); ++i) {
+            int x = pending[i] % WIDTH, y = pending[i] / WIDTH;
+            for (Direction dir : {UP, RIGHT, DOWN, LEFT}) {
+                int nx, ny;
+                if (canMove(x, y, dir, nx, ny) && distance[ny * WIDTH + nx] == INT_MAX) {
+                    distance[ny * WIDTH + nx] = distance[pending[i]] + 1;
+                    pending.push_back(ny * WIDTH + nx);
+                }
+            }
+        }
+        return distance;
+    }
+};
+
+// Random walls on both mazes, then floods from several goals with a 7-node frontier chunk
+static void spillingFlood() {
+    char fileName[] = "/tmp/tiledfloodfill_testXXXXXX";
+    int fd = mkstemp(fileName);
+    assert(fd >= 0);
+    close(fd);
+
+    {
+        TiledMaze tiled(fileName, WIDTH, HEIGHT, 4);  // Fewer mapped tiles than the maze has
+        assert(tiled.isOpen());
+        PlainMaze plain;
+
+        std::srand(21);
+        for (int wall = 0; wall < WIDTH * HEIGHT; ++wall) {
+            int x = std::rand() % WIDTH, y = std::rand() % HEIGHT;
+            Direction dir = static_cast<Direction>(std::rand() % 4);
+            bool exists = std::rand() % 5 != 0;
+            tiled.setWall(x, y, dir, exists);
+
+            int nx, ny;
+            plain.canMove(x, y, dir, nx, ny);
+            for (int side = 0; side < 2; ++side) {
+                int cx = side == 0 ? x : nx, cy = side == 0 ? y : ny;
+                Direction cdir = side == 0 ? dir : static_cast<Direction>((dir + 2) % 4);
+                if (cx < 0 || cx >= WIDTH || cy < 0 || cy >= HEIGHT) continue;
+                if (exists) plain.walls[cy * WIDTH + cx] |= static_cast<unsigned char>(1 << cdir);
+                else        plain.walls[cy * WIDTH + cx] &= static_cast<unsigned char>(~(1 << cdir));
+            }
+        }
+
+        TiledFloodfill floodfill(tiled, 7);
+        const int goals[][2] = { { WIDTH / 2, HEIGHT / 2 }, { 0, 0 }, { WIDTH - 1, HEIGHT - 1 } };
+        for (const auto& goal : goals) {
+            assert(floodfill.updateFloodValues(goal[0], goal[1]));
+            std::vector<int> expected = plain.bfs(goal[0], goal[1]);
+
+            long long reached = 0;
+            for (int y = 0; y < HEIGHT; ++y) {
+                for (int x = 0; x < WIDTH; ++x) {
+                    assert(tiled.getDistance(x, y) == expected[y * WIDTH + x]);
+                    if (expected[y * WIDTH + x] != INT_MAX) reached++;
+                }
+            }
+            assert(floodfill.getCellsReached() == reached);
+            std::cout << "goal (" << goal[0] << ", " << goal[1] << "): " << reached << " cells ok\n";
+        }
+    }
+
+    unlink(fileName);
+}
+
+int main() {
+    spillingFlood();
+    return 0;
+}
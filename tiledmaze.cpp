@@ -0,0 +1,183 @@
+//  This file implements the TiledMaze class defined in tiledmaze.h.
+//  Tiles are mapped from the backing file with mmap when a cell inside them is touched, and unmapped
+//  (written back) when the cache is full. Memory use therefore stays at cacheTiles * tileBytes.
+
+#include "tiledmaze.h"
+#include <iostream>
+#include <climits>
+#include <cstring>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+
+// Constructor: open the backing file and size it to hold every tile (the file stays sparse until written)
+TiledMaze::TiledMaze(const char* fileName, int width, int height, int cacheTiles)
+    : fd(-1), width(width), height(height), useCounter(0), lastSlot(0) {
+    tilesX = (width + TILE_DIM - 1) / TILE_DIM;
+    tilesY = (height + TILE_DIM - 1) / TILE_DIM;
+
+    long long pageSize = sysconf(_SC_PAGESIZE);
+    long long rawBytes = static_cast<long long>(TILE_CELLS) * (sizeof(int32_t) + 1);
+    tileBytes = (rawBytes + pageSize - 1) / pageSize * pageSize;  // mmap offsets must be page aligned
+
+    if (cacheTiles < 1) cacheTiles = 1;
+    slots.resize(cacheTiles, Tile{ -1, nullptr, 0 });
+
+    fd = open(fileName, O_RDWR | O_CREAT, 0644);
+    if (fd < 0) {
+        std::cout << "Error: could not open tile file " << fileName << "\n";
+        return;
+    }
+
+    if (ftruncate(fd, static_cast<off_t>(tileBytes * tilesX * tilesY)) != 0) {
+        std::cout << "Error: could not size tile file " << fileName << "\n";
+        close(fd);
+        fd = -1;
+    }
+}
+
+// Destructor: write back and unmap every cached tile, then close the file
+TiledMaze::~TiledMaze() {
+    for (Tile& slot : slots) {
+        unmapSlot(slot);
+    }
+    if (fd >= 0) close(fd);
+}
+
+// Release a cache slot (MAP_SHARED pages reach the file when unmapped)
+void TiledMaze::unmapSlot(Tile& slot) {
+    if (slot.data) {
+        munmap(slot.data, tileBytes);
+        slotOfTile.erase(slot.index);
+    }
+    slot.index = -1;
+    slot.data = nullptr;
+}
+
+// Map a tile into the cache, evicting the least recently used one if every slot is taken
+uint8_t* TiledMaze::getTile(long long index) {
+    if (fd < 0) return nullptr;
+
+    if (slots[lastSlot].index == index) {
+        slots[lastSlot].lastUse = ++useCounter;
+        return slots[lastSlot].data;
+    }
+
+    auto found = slotOfTile.find(index);
+    if (found != slotOfTile.end()) {
+        lastSlot = found->second;
+        slots[lastSlot].lastUse = ++useCounter;
+        return slots[lastSlot].data;
+    }
+
+    // Pick a free slot, otherwise the oldest one
+    int victim = 0;
+    for (int i = 0; i < static_cast<int>(slots.size()); ++i) {
+        if (slots[i].index < 0) { victim = i; break; }
+        if (slots[i].lastUse < slots[victim].lastUse) victim = i;
+    }
+    unmapSlot(slots[victim]);
+
+    void* data = mmap(nullptr, tileBytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd,
+                      static_cast<off_t>(index * tileBytes));
+    if (data == MAP_FAILED) {
+        std::cout << "Error: could not map tile " << index << "\n";
+        return nullptr;
+    }
+
+    slots[victim] = Tile{ index, static_cast<uint8_t*>(data), ++useCounter };
+    slotOfTile[index] = victim;
+    lastSlot = victim;
+    return slots[victim].data;
+}
+
+// Find the tile holding (x, y) and the cell's offset inside it
+uint8_t* TiledMaze::getTileAt(int x, int y, int& offset) {
+    long long index = static_cast<long long>(y / TILE_DIM) * tilesX + x / TILE_DIM;
+    offset = (y % TILE_DIM) * TILE_DIM + x % TILE_DIM;
+    return getTile(index);
+}
+
+// Determine if a wall is part of the maze's outer boundary
+bool TiledMaze::isBoundaryWall(int x, int y, Direction dir) const {
+    if (dir == UP    && y == 0)           return true; // Top edge
+    if (dir == DOWN  && y == height - 1)  return true; // Bottom edge
+    if (dir == LEFT  && x == 0)           return true; // Left edge
+    if (dir == RIGHT && x == width - 1)   return true; // Right edge
+
+    return false; // Not a boundary wall
+}
+
+// Check if there's a wall at (x, y) in the given direction
+bool TiledMaze::isWall(int x, int y, Direction dir) {
+    if (isBoundaryWall(x, y, dir)) return true;  // Perimeter walls are implicit
+
+    int offset;
+    uint8_t* tile = getTileAt(x, y, offset);
+    if (!tile) return true;  // Treat unreadable tiles as closed
+
+    const uint8_t* walls = tile + TILE_CELLS * sizeof(int32_t);
+    return (walls[offset] >> dir) & 1;
+}
+
+// Add or remove a wall at a given cell and direction, sync with neighbor
+void TiledMaze::setWall(int x, int y, Direction dir, bool exists) {
+    int dx = 0, dy = 0;
+    switch (dir) {
+        case UP:    dy = -1; break;
+        case DOWN:  dy = 1;  break;
+        case LEFT:  dx = -1; break;
+        case RIGHT: dx = 1;  break;
+    }
+
+    // Set wall for this cell, then for the neighbor on the other side
+    for (int side = 0; side < 2; ++side) {
+        int cx = side == 0 ? x : x + dx;
+        int cy = side == 0 ? y : y + dy;
+        Direction cdir = side == 0 ? dir : static_cast<Direction>((dir + 2) % 4);
+        if (cx < 0 || cx >= width || cy < 0 || cy >= height) continue;
+
+        int offset;
+        uint8_t* tile = getTileAt(cx, cy, offset);
+        if (!tile) continue;
+
+        uint8_t* walls = tile + TILE_CELLS * sizeof(int32_t);
+        if (exists) walls[offset] |= static_cast<uint8_t>(1 << cdir);
+        else        walls[offset] &= static_cast<uint8_t>(~(1 << cdir));
+    }
+}
+
+// Return the flood distance of (x, y)
+int TiledMaze::getDistance(int x, int y) {
+    int offset;
+    uint8_t* tile = getTileAt(x, y, offset);
+    if (!tile) return INT_MAX;
+
+    int32_t stored = reinterpret_cast<int32_t*>(tile)[offset];
+    return stored == 0 ? INT_MAX : stored - 1;
+}
+
+// Store the flood distance of (x, y)
+void TiledMaze::setDistance(int x, int y, int distance) {
+    int offset;
+    uint8_t* tile = getTileAt(x, y, offset);
+    if (!tile) return;
+
+    reinterpret_cast<int32_t*>(tile)[offset] = distance == INT_MAX ? 0 : distance + 1;
+}
+
+// Set all distances to infinity, streaming through the file one tile at a time
+void TiledMaze::resetDistances() {
+    long long tileCount = static_cast<long long>(tilesX) * tilesY;
+    for (long long index = 0; index < tileCount; ++index) {
+        uint8_t* tile = getTile(index);
+        if (tile) std::memset(tile, 0, TILE_CELLS * sizeof(int32_t));
+    }
+}
+
+// Push every mapped tile back to the file
+void TiledMaze::flush() {
+    for (Tile& slot : slots) {
+        if (slot.data) msync(slot.data, tileBytes, MS_SYNC);
+    }
+}
@@ -0,0 +1,59 @@
+// This file defines the TiledMaze class, an out-of-core maze for grids that are too big to keep in RAM.
+// The grid is cut into fixed-size square tiles. Each tile holds the wall bits and flood distances of its cells
+// and lives in a memory-mapped file. Tiles are paged in on demand and only a bounded number stay mapped at once.
+
+#ifndef TILEDMAZE_H
+#define TILEDMAZE_H
+
+#include "cell.h"
+#include <cstdint>
+#include <vector>
+#include <unordered_map>
+
+const int TILE_DIM = 64;                        // Tile width and height in cells
+const int TILE_CELLS = TILE_DIM * TILE_DIM;     // Number of cells stored in one tile
+
+class TiledMaze {
+public:
+    // Open (or create) the backing file for a width x height maze, keeping at most cacheTiles tiles mapped
+    TiledMaze(const char* fileName, int width, int height, int cacheTiles);
+    ~TiledMaze();
+    TiledMaze(const TiledMaze&) = delete;             // Owns a file descriptor and mappings
+    TiledMaze& operator=(const TiledMaze&) = delete;
+
+    bool isOpen() const { return fd >= 0; }          // True if the backing file was opened and sized
+    void setWall(int x, int y, Direction dir, bool exists);  // Add or remove a wall at (x, y), sync with neighbor
+    bool isWall(int x, int y, Direction dir);        // Check if a wall exists at (x, y) in a given direction
+    bool isBoundaryWall(int x, int y, Direction dir) const;  // Check if wall is on maze perimeter
+    int getDistance(int x, int y);                   // Flood distance of (x, y), INT_MAX if not reached
+    void setDistance(int x, int y, int distance);    // Store the flood distance of (x, y)
+    void resetDistances();                           // Set every distance to infinity, one tile at a time
+    void flush();                                    // Write all mapped tiles back to the file
+
+    int getWidth() const { return width; }           // Maze width in cells
+    int getHeight() const { return height; }         // Maze height in cells
+    int getCacheTiles() const { return static_cast<int>(slots.size()); }  // Maximum number of mapped tiles
+
+private:
+    // One mapped tile: distances first (stored as distance + 1, 0 means unreached), then one wall byte per cell
+    struct Tile {
+        long long index;          // Tile number in the file, -1 if the slot is free
+        uint8_t* data;            // Start of the mapping
+        unsigned long lastUse;    // Access stamp used for least-recently-used eviction
+    };
+
+    uint8_t* getTile(long long index);               // Map a tile into the cache, evicting the oldest if needed
+    uint8_t* getTileAt(int x, int y, int& offset);   // Tile holding (x, y) and the cell's offset inside it
+    void unmapSlot(Tile& slot);                      // Release a cache slot
+
+    int fd;                       // Backing file descriptor
+    int width, height;            // Maze size in cells
+    int tilesX, tilesY;           // Number of tiles along each axis
+    long long tileBytes;          // Tile size in the file, rounded up to the page size
+    unsigned long useCounter;     // Source of lastUse stamps
+    int lastSlot;                 // Slot of the most recent hit (fast path for neighboring accesses)
+    std::vector<Tile> slots;                         // Tile cache
+    std::unordered_map<long long, int> slotOfTile;   // Tile number -> cache slot
+};
+
+#endif // TILEDMAZE_H